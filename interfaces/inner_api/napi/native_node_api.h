@@ -21,6 +21,7 @@
 #include <string>
 #include <vector>
 
+#include "interfaces/kits/napi/common.h"
 #include "js_native_api.h"
 #include "native_common.h"
 #include "node_api.h"
@@ -31,6 +32,99 @@ typedef void* (*NapiDetachCallback)(napi_env env, void* nativeObject, void* hint
 typedef napi_value (*NapiAttachCallback)(napi_env env, void* nativeObject, void* hint); // hint: attach params
 typedef bool (*napi_module_validate_callback)(const char* moduleName);
 typedef struct napi_fast_native_scope__* napi_fast_native_scope;
+typedef void (*napi_threadsafe_function_call_js_batch)(napi_env env, napi_value js_callback, void* context,
+                                                       void** data, size_t count);
+typedef struct napi_async_work_batch__* napi_async_work_batch;
+typedef struct napi_reference_group__* napi_reference_group;
+typedef struct napi_property_key__* napi_property_key;
+typedef napi_status (*napi_async_batch_execute_callback)(napi_env env, void* data, size_t index);
+typedef void (*napi_async_batch_complete_callback)(napi_env env, napi_status status, void* data,
+                                                   const napi_status* item_status, size_t count);
+typedef void (*napi_threadsafe_function_watermark_callback)(napi_threadsafe_function func, void* context,
+                                                            size_t depth, bool is_high);
+
+typedef struct {
+    // 0 disables the watermark notifications, otherwise low_watermark must be below high_watermark
+    size_t high_watermark;
+    size_t low_watermark;
+    // called on the producer thread which fills the queue up to high_watermark, and on the JS thread once the
+    // queue drained down to low_watermark, it must be thread-safe and must not call into JS
+    napi_threadsafe_function_watermark_callback watermark_cb;
+    // max wait of a blocking call on a full queue before it returns napi_queue_full, 0 waits forever
+    uint64_t blocking_timeout_ms;
+} napi_threadsafe_function_flow_control;
+
+typedef struct {
+    size_t depth;
+    size_t peak_depth;
+    uint64_t blocked_calls;
+    uint64_t blocked_time_us;
+    uint64_t timeouts;
+} napi_threadsafe_function_queue_stats;
+
+typedef struct {
+    // creations served from the pool and creations which had to allocate, hits / (hits + misses) is the hit rate
+    uint64_t hits;
+    uint64_t misses;
+    size_t cached;
+} napi_async_work_pool_stats;
+
+typedef struct {
+    size_t chunks;
+    size_t live_objects;
+    size_t free_slots;
+    size_t reserved_bytes;
+    uint64_t allocations;
+    uint64_t frees;
+} napi_reference_slab_stats;
+
+typedef struct {
+    // live references by ownership and finalizer, runtime owned ones are deleted by the engine
+    size_t runtime_no_finalizer;
+    size_t runtime_sync_finalizer;
+    size_t runtime_async_finalizer;
+    size_t user_no_finalizer;
+    size_t user_sync_finalizer;
+    size_t user_async_finalizer;
+    // slots of the storage tracking the runtime owned references
+    size_t tracked_capacity;
+} napi_reference_stats;
+
+typedef enum {
+    // async work: queued to execute start, execute, execute end to complete callback returned
+    napi_task_latency_queue_wait = 0,
+    napi_task_latency_execute = 1,
+    napi_task_latency_complete = 2,
+    // threadsafe function: call to call_js
+    napi_task_latency_call_js = 3,
+} napi_task_latency_phase;
+
+typedef struct {
+    uint64_t count;
+    uint64_t total_us;
+    uint64_t max_us;
+    // bucket bounds, within 25% of the exact percentiles
+    uint64_t p50_us;
+    uint64_t p90_us;
+    uint64_t p99_us;
+} napi_task_latency_stats;
+
+typedef struct {
+    // finalizers collected by gc which did not run yet and the native binding size they hold
+    size_t pending_finalizers;
+    size_t pending_native_binding_size;
+    // time from collection to run of the finalizers which ran on the js thread
+    napi_task_latency_stats wait;
+} napi_finalizer_stats;
+
+typedef struct {
+    // named property calls whose name was interned already and the ones which were not, the hit rate is
+    // hits / (hits + misses)
+    uint64_t hits;
+    uint64_t misses;
+    // interned names, the ones of napi_create_property_key included
+    size_t keys;
+} napi_property_key_cache_stats;
 
 typedef struct napi_module_with_js {
     int nm_version = 0;
@@ -98,6 +192,27 @@ NAPI_EXTERN napi_status napi_wrap_async_finalizer(napi_env env,
                                                   void* finalize_hint,
                                                   napi_ref* result,
                                                   size_t native_binding_size);
+/*
+ * @brief Add a finalizer which is thread safe to js_object, like napi_add_finalizer
+ *
+ * The finalizer runs on a background worker with a null env, in parallel with other such finalizers, so it must not
+ * call into js. Use it for finalizers which only release native memory.
+ *
+ * @param env The native engine.
+ * @param js_object The object the finalizer is bound to.
+ * @param native_object Data passed to finalize_cb.
+ * @param finalize_cb The finalizer.
+ * @param finalize_hint Hint passed to finalize_cb.
+ * @param result Optional reference to js_object, the finalizer is owned by the runtime when it is null.
+ *
+ * @return napi_status Return add status
+ */
+NAPI_EXTERN napi_status napi_add_async_finalizer(napi_env env,
+                                                 napi_value js_object,
+                                                 void* native_object,
+                                                 napi_finalize finalize_cb,
+                                                 void* finalize_hint,
+                                                 napi_ref* result);
 NAPI_EXTERN napi_status napi_create_external_with_size(napi_env env,
                                                        void* data,
                                                        napi_finalize finalize_cb,
@@ -226,6 +341,593 @@ NAPI_EXTERN napi_status napi_send_cancelable_event(napi_env env,
  * @return napi_status Return cancel event status
  */
 NAPI_EXTERN napi_status napi_cancel_event(napi_env env, uint64_t handleId, const char* name);
+/*
+ * @brief Create a threadsafe function whose call_js receives every item drained in one wakeup at once
+ *
+ * @param env The native engine.
+ * @param call_js_batch_cb Called on the JS thread with all items drained together, and with a null env for the
+ *                         items left in the queue when the function is finalized.
+ * The other parameters are the same as napi_create_threadsafe_function.
+ *
+ * @return napi_status Return create status
+ */
+NAPI_EXTERN napi_status napi_create_threadsafe_function_with_batch_call_js(napi_env env,
+    napi_value func,
+    napi_value async_resource,
+    napi_value async_resource_name,
+    size_t max_queue_size,
+    size_t initial_thread_count,
+    void* thread_finalize_data,
+    napi_finalize thread_finalize_cb,
+    void* context,
+    napi_threadsafe_function_call_js_batch call_js_batch_cb,
+    napi_threadsafe_function* result);
+/*
+ * @brief Enqueue several items to a threadsafe function with a single wakeup of the JS thread
+ *
+ * @param func The threadsafe function.
+ * @param items Items to enqueue, they keep their order and are never interleaved with items of other callers.
+ * @param count Number of items, must not exceed the max_queue_size of a bounded function.
+ * @param is_blocking Whether to wait for space when the queue is full.
+ *
+ * @return napi_status Return call status
+ */
+NAPI_EXTERN napi_status napi_call_threadsafe_function_batch(napi_threadsafe_function func,
+                                                            void** items,
+                                                            size_t count,
+                                                            napi_threadsafe_function_call_mode is_blocking);
+/*
+ * @brief Limit the work a threadsafe function does on the JS thread per wakeup
+ *
+ * @param func The threadsafe function.
+ * @param max_items Max call_js invocations, or items handed to a batch call_js, per wakeup, 0 means unlimited.
+ * @param max_time_us Max time spent draining per wakeup in microseconds, 0 means unlimited.
+ * When the budget runs out the rest of the queue is deferred to the next loop iteration.
+ *
+ * @return napi_status Return set status
+ */
+NAPI_EXTERN napi_status napi_set_threadsafe_function_drain_budget(napi_threadsafe_function func,
+                                                                  size_t max_items,
+                                                                  uint64_t max_time_us);
+/*
+ * @brief Set the drain budget of the threadsafe functions created on env afterwards
+ *
+ * @param env The native engine.
+ * @param max_items Same as napi_set_threadsafe_function_drain_budget.
+ * @param max_time_us Same as napi_set_threadsafe_function_drain_budget.
+ *
+ * @return napi_status Return set status
+ */
+NAPI_EXTERN napi_status napi_set_default_threadsafe_function_drain_budget(napi_env env,
+                                                                          size_t max_items,
+                                                                          uint64_t max_time_us);
+/*
+ * @brief Get how often the drain budget of a threadsafe function ran out
+ *
+ * @param func The threadsafe function.
+ * @param deferred_drains Number of wakeups stopped by the budget.
+ * @param deferred_items Sum of the items those wakeups left in the queue.
+ *
+ * @return napi_status Return get status
+ */
+NAPI_EXTERN napi_status napi_get_threadsafe_function_drain_stats(napi_threadsafe_function func,
+                                                                 uint64_t* deferred_drains,
+                                                                 uint64_t* deferred_items);
+/*
+ * @brief Create a threadsafe function with backpressure options
+ *
+ * @param env The native engine.
+ * @param flow_control Watermarks and blocking timeout, applied on top of max_queue_size.
+ * The other parameters are the same as napi_create_threadsafe_function.
+ *
+ * @return napi_status Return create status
+ */
+NAPI_EXTERN napi_status napi_create_threadsafe_function_with_flow_control(napi_env env,
+    napi_value func,
+    napi_value async_resource,
+    napi_value async_resource_name,
+    size_t max_queue_size,
+    size_t initial_thread_count,
+    void* thread_finalize_data,
+    napi_finalize thread_finalize_cb,
+    void* context,
+    napi_threadsafe_function_call_js call_js_cb,
+    const napi_threadsafe_function_flow_control* flow_control,
+    napi_threadsafe_function* result);
+/*
+ * @brief Get the queue depth, peak depth and the time producers spent blocked on a threadsafe function
+ *
+ * @param func The threadsafe function.
+ * @param stats Receives the counters, which are accumulated since the creation of func.
+ *
+ * @return napi_status Return get status
+ */
+NAPI_EXTERN napi_status napi_get_threadsafe_function_queue_stats(napi_threadsafe_function func,
+                                                                 napi_threadsafe_function_queue_stats* stats);
+/*
+ * @brief Get the counters of the pool napi_create_async_work takes its objects from
+ *
+ * @param env The native engine.
+ * @param stats Receives the pool hits and misses since the creation of env, and the number of cached objects.
+ *
+ * @return napi_status Return get status
+ */
+NAPI_EXTERN napi_status napi_get_async_work_pool_stats(napi_env env, napi_async_work_pool_stats* stats);
+/*
+ * @brief Set how many deleted async works env keeps for reuse, 0 disables the pooling
+ *
+ * @param env The native engine.
+ * @param capacity Max number of cached objects, the default is 64.
+ *
+ * @return napi_status Return set status
+ */
+NAPI_EXTERN napi_status napi_set_async_work_pool_capacity(napi_env env, size_t capacity);
+/*
+ * @brief Get the counters of the slab allocator env takes its napi_ref and napi_sendable_ref objects from
+ *
+ * @param env The native engine.
+ * @param stats Receives the chunks, the objects alive and the free slots, allocations and frees since creation.
+ *
+ * @return napi_status Return get status
+ */
+NAPI_EXTERN napi_status napi_get_reference_slab_stats(napi_env env, napi_reference_slab_stats* stats);
+/*
+ * @brief Get the number of live napi_ref objects of env by ownership and finalizer type
+ *
+ * @param env The native engine.
+ * @param stats Receives the counts and the capacity of the runtime owned reference storage.
+ *
+ * @return napi_status Return get status
+ */
+NAPI_EXTERN napi_status napi_get_reference_stats(napi_env env, napi_reference_stats* stats);
+/*
+ * @brief Cancel an async work, also once its execute callback started. A work which did not start is cancelled like
+ * napi_cancel_async_work. While execute runs, the cancel token read by napi_is_async_work_cancel_requested is set,
+ * and the complete callback gets napi_cancelled whether or not execute stopped early. napi_cancel_async_work itself
+ * still fails on a started work.
+ *
+ * @param env The native engine.
+ * @param work The async work.
+ *
+ * @return napi_status Return cancel status, napi_generic_failure when the work is not queued or execute returned
+ */
+NAPI_EXTERN napi_status napi_request_async_work_cancel(napi_env env, napi_async_work work);
+/*
+ * @brief Check whether the cancel of a running async work was requested with napi_request_async_work_cancel.
+ * The complete callback then gets napi_cancelled.
+ *
+ * @param work The async work, can be called from its execute callback on the work pool thread.
+ * @param result Whether execute should stop early.
+ *
+ * @return napi_status Return check status
+ */
+NAPI_EXTERN napi_status napi_is_async_work_cancel_requested(napi_async_work work, bool* result);
+/*
+ * @brief Run the async works and async finalizers of env on the process wide work stealing executor instead of the
+ * libuv work pool, off by default. The executor has a worker per core and honors the qos of the works, background and
+ * utility works may only occupy part of the workers. Works queued before the switch finish where they were queued.
+ *
+ * @param env The native engine, a context env switches the engine it shares the loop with.
+ * @param enabled Whether works queued from now on go to the executor.
+ *
+ * @return napi_status Return set status, napi_generic_failure when env has no loop to complete the works on
+ */
+NAPI_EXTERN napi_status napi_set_work_stealing_executor_enabled(napi_env env, bool enabled);
+/*
+ * @brief Turn on or off the latency histograms of the async works and threadsafe functions of env, off by default
+ *
+ * @param env The native engine.
+ * @param enabled Works queued and threadsafe functions created while it is on are recorded, per resource name.
+ *
+ * @return napi_status Return set status
+ */
+NAPI_EXTERN napi_status napi_set_task_latency_enabled(napi_env env, bool enabled);
+/*
+ * @brief Get the latency of one phase of the tasks named name
+ *
+ * @param env The native engine.
+ * @param name The async resource name of the works or threadsafe functions.
+ * @param phase The phase to query.
+ * @param stats Receives the stats in microseconds, all zero when nothing was recorded.
+ *
+ * @return napi_status Return get status
+ */
+NAPI_EXTERN napi_status napi_get_task_latency_stats(napi_env env,
+                                                    const char* name,
+                                                    napi_task_latency_phase phase,
+                                                    napi_task_latency_stats* stats);
+/*
+ * @brief Dump all latency histograms of env as JSON, like napi_get_value_string_utf8
+ *
+ * @param env The native engine.
+ * @param buf Buffer for the null terminated JSON, nullptr to only get its length.
+ * @param bufsize Size of buf, the JSON is truncated when it does not fit.
+ * @param result The length of the JSON without the terminator, or the number of bytes copied.
+ *
+ * @return napi_status Return dump status
+ */
+NAPI_EXTERN napi_status napi_dump_task_latency(napi_env env, char* buf, size_t bufsize, size_t* result);
+/*
+ * @brief Drop the latency histograms recorded so far
+ *
+ * @param env The native engine.
+ *
+ * @return napi_status Return reset status
+ */
+NAPI_EXTERN napi_status napi_reset_task_latency(napi_env env);
+/*
+ * @brief Get the state of the finalizers env runs on its js thread
+ *
+ * Finalizers collected by gc run in short slices between loop events and in idle windows, and all at once only when
+ * the native binding size they hold gets too large.
+ *
+ * @param env The native engine.
+ * @param stats Receives the pending finalizers and how long the finalizers waited before they ran.
+ *
+ * @return napi_status Return get status
+ */
+NAPI_EXTERN napi_status napi_get_finalizer_stats(napi_env env, napi_finalizer_stats* stats);
+/*
+ * @brief Turn the timing of finalizer callbacks on or off, it is process wide and off by default
+ *
+ * @param env The native engine.
+ * @param enabled Whether each finalizer callback run by gc is timed.
+ *
+ * @return napi_status Return set status
+ */
+NAPI_EXTERN napi_status napi_set_finalizer_profiling_enabled(napi_env env, bool enabled);
+/*
+ * @brief Dump the finalizer callbacks timed so far as JSON, like napi_dump_task_latency
+ *
+ * The callbacks are resolved to module and symbol, the JSON lists the top_n callbacks with the longest single run
+ * under "slowest" and the top_n most frequent ones under "mostFrequent", each with count, total, max and average.
+ *
+ * @param env The native engine.
+ * @param top_n Max number of callbacks in each list.
+ * @param buf Buffer for the null terminated JSON, nullptr to only get its length.
+ * @param bufsize Size of buf, the JSON is truncated when it does not fit.
+ * @param result The length of the JSON without the terminator, or the number of bytes copied.
+ *
+ * @return napi_status Return dump status
+ */
+NAPI_EXTERN napi_status napi_dump_finalizer_profile(napi_env env,
+                                                    size_t top_n,
+                                                    char* buf,
+                                                    size_t bufsize,
+                                                    size_t* result);
+/*
+ * @brief Drop the finalizer timings recorded so far
+ *
+ * @param env The native engine.
+ *
+ * @return napi_status Return reset status
+ */
+NAPI_EXTERN napi_status napi_reset_finalizer_profile(napi_env env);
+/*
+ * @brief Sample where references are created to find leaking call sites, it is process wide and off by default
+ *
+ * Every interval-th reference created on a thread, wraps included, records its native stack and, on the js thread,
+ * its js stack. It counts live at that site until it is deleted or its object is collected. References which are not
+ * sampled only count down a thread local, so a large interval is cheap enough to leave on.
+ *
+ * @param env The native engine.
+ * @param interval Sample one of interval references, 0 to stop sampling.
+ *
+ * @return napi_status Return set status
+ */
+NAPI_EXTERN napi_status napi_set_reference_sampling_interval(napi_env env, uint32_t interval);
+/*
+ * @brief Dump the sampled allocation sites with the most live references as JSON, like napi_dump_task_latency
+ *
+ * The JSON lists up to top_n sites under "sites", each with its live and total sampled references, its native frames
+ * resolved to module and symbol and its js stack.
+ *
+ * @param env The native engine.
+ * @param top_n Max number of sites.
+ * @param buf Buffer for the null terminated JSON, nullptr to only get its length.
+ * @param bufsize Size of buf, the JSON is truncated when it does not fit.
+ * @param result The length of the JSON without the terminator, or the number of bytes copied.
+ *
+ * @return napi_status Return dump status
+ */
+NAPI_EXTERN napi_status napi_dump_reference_sites(napi_env env,
+                                                  size_t top_n,
+                                                  char* buf,
+                                                  size_t bufsize,
+                                                  size_t* result);
+/*
+ * @brief Make the wraps of env keep their reference on the wrapped object itself, off by default
+ *
+ * napi_wrap and its variants then store the reference in native pointer fields of the target instead of a separate
+ * wrapper object defined on it, which saves a heap object and a property per wrap and a property lookup per
+ * napi_unwrap. Proxies, sendable objects, objects which have native pointer fields of their own and objects already
+ * wrapped by a wrapper object still get a wrapper object. napi_wrap_s and napi_unwrap_s are not affected.
+ * napi_type_tag_object stores the type tag in the same fields instead of a property.
+ *
+ * @param env The native engine.
+ * @param enabled Whether the following wraps and type tags of env are stored on the wrapped object.
+ *
+ * @return napi_status Return set status
+ */
+NAPI_EXTERN napi_status napi_set_direct_wrap_enabled(napi_env env, bool enabled);
+/*
+ * @brief Wrap count objects in one call, like napi_wrap on each of them
+ *
+ * The objects are given either as the first count elements of js_array or as the js_objects array, the other one
+ * must be NULL. Every object is checked before any is wrapped. The references of the batch are allocated together.
+ *
+ * @param env The native engine.
+ * @param js_array A JS array holding the objects, or NULL.
+ * @param js_objects An array of count objects, or NULL.
+ * @param count Number of objects to wrap.
+ * @param native_objects The native instance of every object, none of them NULL.
+ * @param finalize_cb Called for every native instance when its object is garbage collected.
+ * @param finalize_hint Hint passed to every finalize_cb.
+ * @param native_binding_size Native memory held by each native instance, reported to gc.
+ * @param results Optional array of count references to the wrapped objects, NULL like a NULL result of napi_wrap.
+ *
+ * @return napi_status Return wrap status, napi_object_expected when some element is not an object
+ */
+NAPI_EXTERN napi_status napi_wrap_batch(napi_env env,
+                                        napi_value js_array,
+                                        const napi_value* js_objects,
+                                        size_t count,
+                                        void* const* native_objects,
+                                        napi_finalize finalize_cb,
+                                        void* finalize_hint,
+                                        size_t native_binding_size,
+                                        napi_ref* results);
+/*
+ * @brief Unwrap count objects in one call, like napi_unwrap on each of them
+ *
+ * @param env The native engine.
+ * @param js_array A JS array holding the objects, or NULL.
+ * @param js_objects An array of count objects, or NULL.
+ * @param count Number of objects to unwrap.
+ * @param results Receives the native instance of every object, NULL for objects which are not wrapped.
+ *
+ * @return napi_status Return unwrap status, napi_object_expected when some element is not an object
+ */
+NAPI_EXTERN napi_status napi_unwrap_batch(napi_env env,
+                                          napi_value js_array,
+                                          const napi_value* js_objects,
+                                          size_t count,
+                                          void** results);
+/*
+ * @brief Resolve count references in one call, like napi_get_reference_value on each of them
+ *
+ * @param env The native engine.
+ * @param refs An array of count references.
+ * @param count Number of references to resolve.
+ * @param results Receives the value of every reference, NULL for weak references whose object was collected.
+ * @param dead_count Optional, receives the number of NULL results.
+ *
+ * @return napi_status Return get status
+ */
+NAPI_EXTERN napi_status napi_get_reference_values(napi_env env,
+                                                  const napi_ref* refs,
+                                                  size_t count,
+                                                  napi_value* results,
+                                                  size_t* dead_count);
+/*
+ * @brief Create an empty reference group, a set of references resolved together, js thread of env only
+ *
+ * @param env The native engine.
+ * @param result Receives the group.
+ *
+ * @return napi_status Return create status
+ */
+NAPI_EXTERN napi_status napi_create_reference_group(napi_env env, napi_reference_group* result);
+/*
+ * @brief Delete a reference group and the references of its members
+ *
+ * @param env The native engine.
+ * @param group The group to delete.
+ *
+ * @return napi_status Return delete status
+ */
+NAPI_EXTERN napi_status napi_delete_reference_group(napi_env env, napi_reference_group group);
+/*
+ * @brief Add a value to a reference group, the group keeps its own reference to it
+ *
+ * @param env The native engine.
+ * @param group The group to add to.
+ * @param value The value to add.
+ * @param initial_refcount Refcount of the member reference, 0 for a weak member which leaves the group once its
+ * object is collected.
+ *
+ * @return napi_status Return add status
+ */
+NAPI_EXTERN napi_status napi_reference_group_add(napi_env env,
+                                                 napi_reference_group group,
+                                                 napi_value value,
+                                                 uint32_t initial_refcount);
+/*
+ * @brief Remove the first member of a reference group which is strictly equal to value
+ *
+ * @param env The native engine.
+ * @param group The group to remove from.
+ * @param value The value to remove.
+ *
+ * @return napi_status Return remove status, napi_invalid_arg when value is not a member
+ */
+NAPI_EXTERN napi_status napi_reference_group_remove(napi_env env, napi_reference_group group, napi_value value);
+/*
+ * @brief Resolve the members of a reference group in insertion order, members whose object was collected are
+ * dropped from the group
+ *
+ * @param env The native engine.
+ * @param group The group to resolve.
+ * @param results Receives up to capacity values, can be NULL when capacity is 0.
+ * @param capacity Size of results.
+ * @param count Receives the number of live members, which can be above capacity.
+ *
+ * @return napi_status Return get status
+ */
+NAPI_EXTERN napi_status napi_reference_group_get_values(napi_env env,
+                                                        napi_reference_group group,
+                                                        napi_value* results,
+                                                        size_t capacity,
+                                                        size_t* count);
+/*
+ * @brief Check the type tag of an object and unwrap it in one call. Objects wrapped or tagged while direct wrap is
+ * enabled keep the tag next to the wrap, the check then does no property lookup.
+ *
+ * @param env The native engine.
+ * @param js_object The object to check and unwrap.
+ * @param type_tag The type tag the object must carry.
+ * @param result Receives the native instance, NULL when the object is tagged but not wrapped.
+ *
+ * @return napi_status Return unwrap status, napi_invalid_arg when the object does not carry type_tag
+ */
+NAPI_EXTERN napi_status napi_unwrap_with_type_tag(napi_env env,
+                                                  napi_value js_object,
+                                                  const napi_type_tag* type_tag,
+                                                  void** result);
+/*
+ * @brief Report a change of the native memory kept alive by js objects, from any thread. Reports are summed up
+ * without a lock and handed to the vm on the js thread after a gc, when idle, or once the sum since the last flush
+ * reaches the flush threshold, see napi_set_external_memory_flush_threshold.
+ *
+ * @param env The native engine, it must outlive the calls made from other threads.
+ * @param change_in_bytes The change in bytes, negative when memory was released.
+ *
+ * @return napi_status Return report status
+ */
+NAPI_EXTERN napi_status napi_report_external_memory(napi_env env, int64_t change_in_bytes);
+/*
+ * @brief Set how far, in either direction, the pending external memory change may grow before the js thread flushes
+ * it to the vm without waiting for the next gc. 1MB by default.
+ *
+ * @param env The native engine.
+ * @param threshold_in_bytes The threshold, greater than 0.
+ *
+ * @return napi_status Return set status
+ */
+NAPI_EXTERN napi_status napi_set_external_memory_flush_threshold(napi_env env, int64_t threshold_in_bytes);
+/*
+ * @brief Intern a property name of env and return a key handle for it, which napi_get_property_by_key,
+ * napi_set_property_by_key and napi_has_property_by_key use with no utf8 decoding or hashing of the name.
+ * Interning the same name again returns the same key. The key belongs to env, it is rejected on any other env and
+ * invalid once env is destroyed.
+ *
+ * @param env The native engine.
+ * @param utf8name The property name, encoded as utf8.
+ * @param length Length of utf8name in bytes, or NAPI_AUTO_LENGTH if it is null terminated.
+ * @param result Receives the key.
+ *
+ * @return napi_status Return create status
+ */
+NAPI_EXTERN napi_status napi_create_property_key(napi_env env,
+                                                 const char* utf8name,
+                                                 size_t length,
+                                                 napi_property_key* result);
+/*
+ * @brief Set a property of an object by a key of napi_create_property_key, like napi_set_named_property.
+ *
+ * @param env The native engine which created key. A key of another env, or of one already destroyed, is invalid.
+ * @param object The object to set the property on.
+ * @param key The property key.
+ * @param value The property value.
+ *
+ * @return napi_status Return set status, napi_invalid_arg when key was created by another env
+ */
+NAPI_EXTERN napi_status napi_set_property_by_key(napi_env env,
+                                                 napi_value object,
+                                                 napi_property_key key,
+                                                 napi_value value);
+/*
+ * @brief Check whether an object has a property by a key of napi_create_property_key, like napi_has_named_property.
+ *
+ * @param env The native engine which created key. A key of another env, or of one already destroyed, is invalid.
+ * @param object The object to check.
+ * @param key The property key.
+ * @param result Receives whether the property exists.
+ *
+ * @return napi_status Return check status, napi_invalid_arg when key was created by another env
+ */
+NAPI_EXTERN napi_status napi_has_property_by_key(napi_env env,
+                                                 napi_value object,
+                                                 napi_property_key key,
+                                                 bool* result);
+/*
+ * @brief Get a property of an object by a key of napi_create_property_key, like napi_get_named_property.
+ *
+ * @param env The native engine which created key. A key of another env, or of one already destroyed, is invalid.
+ * @param object The object to get the property from.
+ * @param key The property key.
+ * @param result Receives the property value.
+ *
+ * @return napi_status Return get status, napi_invalid_arg when key was created by another env
+ */
+NAPI_EXTERN napi_status napi_get_property_by_key(napi_env env,
+                                                 napi_value object,
+                                                 napi_property_key key,
+                                                 napi_value* result);
+/*
+ * @brief Get the counters of the property name cache of env
+ *
+ * napi_get_named_property, napi_set_named_property and napi_has_named_property intern the first names they see, up
+ * to 256 names of at most 64 bytes, and reuse the interned string for a name seen before.
+ *
+ * @param env The native engine.
+ * @param stats Receives the cache hits and misses since the creation of env, and the number of interned names.
+ *
+ * @return napi_status Return get status
+ */
+NAPI_EXTERN napi_status napi_get_property_key_cache_stats(napi_env env, napi_property_key_cache_stats* stats);
+/*
+ * @brief Create a batch of count async items which complete with a single callback
+ *
+ * @param env The native engine.
+ * @param async_resource_name Identifier of the batch, used as its task name.
+ * @param count Number of items, execute is called once with every index in [0, count) on the work pool.
+ * @param execute Executes one item and returns its status, called concurrently from several threads.
+ * @param complete Called once on the loop thread after every item finished or was cancelled. status is napi_ok
+ * when every item returned napi_ok, napi_cancelled when some items were skipped by a cancel, otherwise
+ * napi_generic_failure.
+ * @param data User data passed to execute and complete.
+ * @param report_item_status Whether complete receives the status of every item, otherwise item_status is NULL.
+ * @param result Result of the batch.
+ *
+ * @return napi_status Return create status
+ */
+NAPI_EXTERN napi_status napi_create_async_work_batch(napi_env env,
+                                                     napi_value async_resource_name,
+                                                     size_t count,
+                                                     napi_async_batch_execute_callback execute,
+                                                     napi_async_batch_complete_callback complete,
+                                                     void* data,
+                                                     bool report_item_status,
+                                                     napi_async_work_batch* result);
+/*
+ * @brief Submit every item of a batch to the work pool, the batch can be queued again once it completed
+ *
+ * @param env The native engine.
+ * @param batch The batch to queue.
+ * @param qos The qos of the work pool threads running the items.
+ *
+ * @return napi_status Return queue status
+ */
+NAPI_EXTERN napi_status napi_queue_async_work_batch(napi_env env, napi_async_work_batch batch, napi_qos_t qos);
+/*
+ * @brief Cancel the items of a queued batch which did not start yet, they are reported as napi_cancelled
+ *
+ * @param env The native engine.
+ * @param batch The batch to cancel.
+ *
+ * @return napi_status Return cancel status
+ */
+NAPI_EXTERN napi_status napi_cancel_async_work_batch(napi_env env, napi_async_work_batch batch);
+/*
+ * @brief Delete a batch, it must not be in flight: a queued batch can be deleted from or after its complete callback
+ *
+ * @param env The native engine.
+ * @param batch The batch to delete.
+ *
+ * @return napi_status Return delete status, napi_generic_failure while the batch is queued or its items are running
+ */
+NAPI_EXTERN napi_status napi_delete_async_work_batch(napi_env env, napi_async_work_batch batch);
 NAPI_EXTERN napi_status napi_open_fast_native_scope(napi_env env, napi_fast_native_scope* scope);
 NAPI_EXTERN napi_status napi_close_fast_native_scope(napi_env env, napi_fast_native_scope scope);
 NAPI_EXTERN napi_status napi_get_shared_array_buffer_info(napi_env env,
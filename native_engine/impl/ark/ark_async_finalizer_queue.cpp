@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ark_async_finalizer_queue.h"
+
+#include <algorithm>
+
+#include "utils/log.h"
+
+ArkAsyncFinalizerQueue::~ArkAsyncFinalizerQueue()
+{
+    for (Task* task : idleTasks_) {
+        delete task;
+    }
+}
+
+ArkAsyncFinalizerQueue::Task* ArkAsyncFinalizerQueue::AcquireTask()
+{
+    activeTasks_++;
+    if (idleTasks_.empty()) {
+        auto task = new Task();
+        task->owner = this;
+        return task;
+    }
+    Task* task = idleTasks_.back();
+    idleTasks_.pop_back();
+    return task;
+}
+
+void ArkAsyncFinalizerQueue::Post(uv_loop_t* loop,
+                                  NativeAsyncExecutor* executor,
+                                  std::vector<RefAsyncFinalizer>& pending)
+{
+    size_t total = pending.size();
+    if (total == 0) {
+        return;
+    }
+    size_t taskCount = std::min(MAX_TASKS_PER_POST, (total + MIN_FINALIZERS_PER_TASK - 1) / MIN_FINALIZERS_PER_TASK);
+    size_t perTask = (total + taskCount - 1) / taskCount;
+    std::vector<Task*> tasks;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        // the pool is busy with earlier tasks, a small flush joins the last one which did not start rather than
+        // waiting behind it in a task of its own, as long as that one is small too. Larger flushes are split as usual
+        // so a task never grows past what one worker should take.
+        if (total < MIN_FINALIZERS_PER_TASK && !queuedTasks_.empty() &&
+            queuedTasks_.back()->finalizers.size() < MIN_FINALIZERS_PER_TASK) {
+            auto& finalizers = queuedTasks_.back()->finalizers;
+            finalizers.insert(finalizers.end(), pending.begin(), pending.end());
+            pending.clear();
+            return;
+        }
+        // async finalizers do not touch js and get no env, so the tasks may run at the same time in any order
+        tasks.reserve(taskCount);
+        for (size_t offset = 0; offset < total; offset += perTask) {
+            Task* task = AcquireTask();
+            auto begin = pending.begin() + offset;
+            task->finalizers.assign(begin, begin + std::min(perTask, total - offset));
+            queuedTasks_.push_back(task);
+            tasks.push_back(task);
+        }
+    }
+    pending.clear();
+    for (Task* task : tasks) {
+        Submit(loop, executor, task);
+    }
+}
+
+void ArkAsyncFinalizerQueue::Submit(uv_loop_t* loop, NativeAsyncExecutor* executor, Task* task)
+{
+    if (executor != nullptr) {
+        bool submitted = executor->Submit(napi_qos_background, { [](void* data) {
+            Task* task = reinterpret_cast<Task*>(data);
+            Run(task);
+            HILOG_DEBUG("executor async finalizers running");
+            Release(task);
+        }, task });
+        if (!submitted) {
+            HILOG_ERROR("submit async finalizers to executor failed");
+            Run(task);
+            Release(task);
+        }
+        return;
+    }
+    task->work = uv_work_t();
+    task->work.data = task;
+    int ret = uv_queue_work_with_qos(loop, &task->work, [](uv_work_t* work) {
+        Run(reinterpret_cast<Task*>(work->data));
+        HILOG_DEBUG("uv_queue_work async running ");
+    }, [](uv_work_t* work, int32_t) {
+        // the uv_work_t is only free to reuse once its after callback came
+        Release(reinterpret_cast<Task*>(work->data));
+    }, uv_qos_t(napi_qos_background));
+    if (ret != 0) {
+        HILOG_ERROR("uv_queue_work fail ret '%{public}d'", ret);
+        Run(task);
+        Release(task);
+    }
+}
+
+void ArkAsyncFinalizerQueue::Run(Task* task)
+{
+    ArkAsyncFinalizerQueue* owner = task->owner;
+    {
+        // no flush joins the task from here on
+        std::lock_guard<std::mutex> lock(owner->mutex_);
+        auto& queued = owner->queuedTasks_;
+        queued.erase(std::find(queued.begin(), queued.end(), task));
+    }
+    owner->runner_(&task->finalizers);
+}
+
+void ArkAsyncFinalizerQueue::Release(Task* task)
+{
+    ArkAsyncFinalizerQueue* owner = task->owner;
+    // the capacity is kept for the next flush
+    task->finalizers.clear();
+    bool deleteOwner = false;
+    {
+        std::lock_guard<std::mutex> lock(owner->mutex_);
+        owner->activeTasks_--;
+        if (!owner->detached_ && owner->idleTasks_.size() < MAX_IDLE_TASKS) {
+            owner->idleTasks_.push_back(task);
+            task = nullptr;
+        }
+        deleteOwner = owner->detached_ && owner->activeTasks_ == 0;
+    }
+    delete task;
+    if (deleteOwner) {
+        delete owner;
+    }
+}
+
+void ArkAsyncFinalizerQueue::Detach()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        detached_ = true;
+        if (activeTasks_ != 0) {
+            HILOG_DEBUG("async finalizer queue outlives its owner, %{public}zu tasks alive", activeTasks_);
+            return;
+        }
+    }
+    delete this;
+}
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_NAPI_NATIVE_ENGINE_ARK_ASYNC_FINALIZER_QUEUE_H
+#define FOUNDATION_ACE_NAPI_NATIVE_ENGINE_ARK_ASYNC_FINALIZER_QUEUE_H
+
+#include <cstddef>
+#include <mutex>
+#include <uv.h>
+#include <vector>
+
+#include "native_engine/impl/ark/ark_finalizers_pack.h"
+#include "native_engine/native_async_executor.h"
+
+/*
+ * Hands the async finalizers of an engine to the work pool. A task holds its uv_work_t and finalizer vector and is
+ * reused once it ran, so the vector keeps its capacity, up to MAX_IDLE_TASKS idle tasks are kept. A small flush
+ * while a small task of the queue has not started yet is appended to it instead of posting another one. The owner
+ * Detaches the queue rather than deleting it, it then goes away with its last task, see NativeSlabAllocator.
+ */
+class ArkAsyncFinalizerQueue {
+public:
+    using Runner = void (*)(std::vector<RefAsyncFinalizer>* finalizers);
+
+    // async finalizers are split in tasks of at least this many so they run in parallel, in at most
+    // MAX_TASKS_PER_POST tasks which matches the default size of the uv work pool
+    static constexpr size_t MIN_FINALIZERS_PER_TASK = 64;
+    static constexpr size_t MAX_TASKS_PER_POST = 4;
+    static constexpr size_t MAX_IDLE_TASKS = MAX_TASKS_PER_POST;
+
+    explicit ArkAsyncFinalizerQueue(Runner runner) : runner_(runner) {}
+
+    ArkAsyncFinalizerQueue(const ArkAsyncFinalizerQueue&) = delete;
+    ArkAsyncFinalizerQueue& operator=(const ArkAsyncFinalizerQueue&) = delete;
+
+    // loop thread only, moves the finalizers out of pending, to executor when it is set and to loop otherwise
+    void Post(uv_loop_t* loop, NativeAsyncExecutor* executor, std::vector<RefAsyncFinalizer>& pending);
+    // replaces delete for the owner, no post may follow
+    void Detach();
+
+    size_t GetIdleTaskCount() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return idleTasks_.size();
+    }
+
+    // tasks posted which did not start yet
+    size_t GetQueuedTaskCount() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return queuedTasks_.size();
+    }
+
+private:
+    struct Task {
+        uv_work_t work;
+        ArkAsyncFinalizerQueue* owner = nullptr;
+        std::vector<RefAsyncFinalizer> finalizers;
+    };
+
+    ~ArkAsyncFinalizerQueue();
+
+    Task* AcquireTask();
+    void Submit(uv_loop_t* loop, NativeAsyncExecutor* executor, Task* task);
+    static void Run(Task* task);
+    static void Release(Task* task);
+
+    Runner runner_;
+    mutable std::mutex mutex_;
+    std::vector<Task*> idleTasks_;
+    std::vector<Task*> queuedTasks_;
+    // tasks handed out and not released yet
+    size_t activeTasks_ = 0;
+    bool detached_ = false;
+};
+
+#endif /* FOUNDATION_ACE_NAPI_NATIVE_ENGINE_ARK_ASYNC_FINALIZER_QUEUE_H */
@@ -16,9 +16,15 @@
 #ifndef FOUNDATION_ACE_NAPI_NATIVE_ENGINE_ARK_FINALIZERS_PACK_H
 #define FOUNDATION_ACE_NAPI_NATIVE_ENGINE_ARK_FINALIZERS_PACK_H
 
+#include <algorithm>
+#include <utility>
+#include <vector>
+
 #include "ecmascript/napi/include/jsnapi_expo.h"
 
 #include "interfaces/inner_api/napi/native_node_api.h"
+#include "native_engine/native_finalizer_profiler.h"
+#include "native_engine/native_task_latency.h"
 
 class NativeEngine;
 
@@ -34,9 +40,15 @@ public:
     DEFAULT_MOVE_SEMANTIC(ArkFinalizersPack);
     DEFAULT_COPY_SEMANTIC(ArkFinalizersPack);
 
+    // the clock is checked every SLICE_CHECK_INTERVAL finalizers of a slice
+    static constexpr size_t SLICE_CHECK_INTERVAL = 16;
+    static constexpr uint64_t NS_PER_US = 1000;
+
     void Clear()
     {
         finalizers_.clear();
+        processed_ = 0;
+        queued_.clear();
         totalNativeBindingSize_ = 0;
         notify_ = nullptr;
     }
@@ -52,16 +64,58 @@ public:
     {
         return finalizers_.size();
     }
-    void ProcessAll() const
+    size_t GetNumPending() const
+    {
+        return finalizers_.size() - processed_;
+    }
+    bool IsFinished() const
+    {
+        return processed_ == finalizers_.size();
+    }
+    // records the wait until startNs of the finalizers [begin, end), each against the time its flush was queued
+    void RecordWait(NativeLatencyHistogram &histogram, uint64_t startNs, size_t begin, size_t end) const
+    {
+        for (size_t i = 0; i < queued_.size() && begin < end; ++i) {
+            size_t rangeEnd = i + 1 < queued_.size() ? queued_[i + 1].first : finalizers_.size();
+            if (rangeEnd <= begin) {
+                continue;
+            }
+            size_t count = std::min(rangeEnd, end) - begin;
+            histogram.Record((startNs - queued_[i].second) / NS_PER_US, count);
+            begin += count;
+        }
+    }
+    void ProcessAll()
+    {
+        ProcessSlice(UINT64_MAX);
+    }
+    // runs the finalizers from where the last slice stopped, at least one, until deadlineNs passed
+    // returns the number of finalizers run, the finish notify comes with the last one
+    size_t ProcessSlice(uint64_t deadlineNs)
     {
         INIT_CRASH_HOLDER(holder, "NAPI");
-        for (auto &iter : finalizers_) {
-            NapiNativeFinalize callback = iter.first;
-            auto &[p0, p1, p2] = iter.second;
+        NativeFinalizerProfiler &profiler = NativeFinalizerProfiler::GetInstance();
+        bool profiling = profiler.IsEnabled();
+        size_t begin = processed_;
+        while (processed_ < finalizers_.size()) {
+            auto &finalizer = finalizers_[processed_++];
+            NapiNativeFinalize callback = finalizer.first;
+            auto &[p0, p1, p2] = finalizer.second;
             holder.UpdateCallbackPtr(reinterpret_cast<uintptr_t>(callback));
+            uint64_t callbackBeginNs = profiling ? NativeTaskLatencyRecorder::Now() : 0;
             callback(reinterpret_cast<napi_env>(p0), p1, p2);
+            if (profiling) {
+                profiler.Record(reinterpret_cast<const void *>(callback),
+                    NativeTaskLatencyRecorder::Now() - callbackBeginNs);
+            }
+            if ((processed_ - begin) % SLICE_CHECK_INTERVAL == 0 && NativeTaskLatencyRecorder::Now() >= deadlineNs) {
+                break;
+            }
+        }
+        if (processed_ == finalizers_.size()) {
+            NotifyFinish();
         }
-        NotifyFinish();
+        return processed_ - begin;
     }
     size_t GetTotalNativeBindingSize() const
     {
@@ -69,9 +123,23 @@ public:
     }
     void AddFinalizer(RefFinalizer &finalizer, size_t nativeBindingSize)
     {
+        if (finalizers_.empty()) {
+            queued_.emplace_back(0, NativeTaskLatencyRecorder::Now());
+        }
         finalizers_.emplace_back(finalizer);
         totalNativeBindingSize_ += nativeBindingSize;
     }
+    // moves the finalizers of other behind the pending ones, other is left cleared with its capacity
+    void Append(ArkFinalizersPack &other)
+    {
+        // the appended finalizers keep the time of their own flush
+        for (const auto &[first, queuedNs] : other.queued_) {
+            queued_.emplace_back(finalizers_.size() + first, queuedNs);
+        }
+        finalizers_.insert(finalizers_.end(), other.finalizers_.begin(), other.finalizers_.end());
+        totalNativeBindingSize_ += other.totalNativeBindingSize_;
+        other.Clear();
+    }
 private:
     void NotifyFinish() const
     {
@@ -80,6 +148,9 @@ private:
         }
     }
     std::vector<RefFinalizer> finalizers_ {};
+    size_t processed_ {0};
+    // index of the first finalizer of every flush added and the steady clock time it was queued
+    std::vector<std::pair<size_t, uint64_t>> queued_ {};
     size_t totalNativeBindingSize_ {0};
     ArkFinalizersPackFinishNotify notify_ {nullptr};
 };
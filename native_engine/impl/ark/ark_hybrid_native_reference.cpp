@@ -79,11 +79,12 @@ void ArkXRefNativeReference::ArkNativeReferenceConstructor()
         value_.SetWeakCallback(reinterpret_cast<void*>(this), FreeXRefGlobalCallBack, NativeFinalizeCallBack);
     }
 
-    if (ownership_ == ReferenceOwnerShip::RUNTIME) {
-        NativeReferenceManager* referenceManager = engine_->GetReferenceManager();
-        if (referenceManager != nullptr) {
-            referenceManager->CreateHandler(this);
-        }
+    if (napiCallback_ != nullptr) {
+        finalizerKind_ = IsAsyncCall() ? NativeReferenceFinalizer::ASYNC : NativeReferenceFinalizer::SYNC;
+    }
+    NativeReferenceManager* referenceManager = engine_->GetReferenceManager();
+    if (referenceManager != nullptr) {
+        referenceManager->CreateHandler(this);
     }
 
     engineId_ = engine_->GetId();
@@ -106,6 +106,9 @@ void ArkIdleMonitor::NotifyLooperIdleStart(int64_t timestamp, [[maybe_unused]] i
     CheckShortIdleTask(timestamp, idleTime);
 #endif
     SetNotifyTimestamp(timestamp);
+    if (idleTaskCallback_ && idleTime > 0) {
+        idleTaskCallback_(idleTime);
+    }
 }
 
 void ArkIdleMonitor::CheckShortIdleTask(int64_t timestamp, int idleTime)
@@ -225,6 +225,12 @@ public:
         externalClearCallback_ = std::move(func);
     }
 
+    // called on the main thread as the looper goes idle with the expected idle time in ms, nullptr to remove
+    void SetIdleTaskCallback(std::function<void(int)>&& func)
+    {
+        idleTaskCallback_ = std::move(func);
+    }
+
     template<typename T, int N>
     class RingBuffer {
     public:
@@ -388,6 +394,7 @@ private:
     void* dynamicLoadHandle_ {nullptr};
     ReportDataFunc reportDataFunc_ {nullptr};
     std::function<void()> externalClearCallback_;
+    std::function<void(int)> idleTaskCallback_;
     std::mutex waitGCFinishjedMutex_;
     std::condition_variable gcFinishCV_;
     std::atomic<bool> duringBackgroundTask_ {false};
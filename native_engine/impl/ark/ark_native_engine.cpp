@@ -15,6 +15,7 @@
 
 #include "ark_native_engine.h"
 
+#include <algorithm>
 #include <cinttypes>
 #include <cstdint>
 
@@ -111,6 +112,7 @@ static std::unordered_set<std::string> NATIVE_MODULE = {"system.app", "ohos.app"
 static constexpr auto NATIVE_MODULE_PREFIX = "@native:";
 static constexpr auto OHOS_MODULE_PREFIX = "@ohos:";
 static constexpr int ARGC_THREE = 3;
+static constexpr uint64_t NS_PER_MS = 1000 * 1000;
 
 // See `ArkNativeEngine::RequireNapi` for more information.
 #ifndef PREVIEW
@@ -562,6 +564,11 @@ ArkNativeEngine::ArkNativeEngine(EcmaVM* vm, void* jsEngine, bool isLimitedWorke
 
     // enable idle gc
     ArkIdleMonitor::GetInstance()->EnableIdleGC(this);
+    if (JSNApi::IsJSMainThreadOfEcmaVM(vm)) {
+        ArkIdleMonitor::GetInstance()->SetIdleTaskCallback([this](int idleTime) {
+            this->RunFinalizersInIdle(idleTime);
+        });
+    }
     InitPostTaskToThreadCallback();
 }
 
@@ -627,12 +634,34 @@ ArkNativeEngine::~ArkNativeEngine()
     if (isMainEnvContext_) {
         // unregister worker env for idle GC
         ArkIdleMonitor::GetInstance()->UnregisterEnv(this);
+        if (JSNApi::IsJSMainThreadOfEcmaVM(vm_)) {
+            ArkIdleMonitor::GetInstance()->SetIdleTaskCallback(nullptr);
+        }
         JSNApi::SetTimerTaskCallback(vm_, nullptr);
         JSNApi::SetCancelTimerCallback(vm_, nullptr);
         NativeTimerCallbackInfo::ReleaseTimerList(this);
         JSNApi::SetPostTaskToThreadCallback(vm_, nullptr);
         // destroy looper resource on the ark native engine
         Deinit();
+        // the loop reran slices as it closed, packs are only left when it could not run, their finalizers still
+        // release native memory and run here, gc posts no new packs from the destructor
+        if (!finalizerPacks_.empty()) {
+            panda::JsiNativeScope nativeScope(vm_);
+            RunFinalizerSlices(UINT64_MAX);
+        }
+        for (ArkFinalizersPack *finalizersPack : finalizerPacks_) {
+            delete finalizersPack;
+        }
+        finalizerPacks_.clear();
+        for (ArkFinalizersPack *finalizersPack : idleFinalizersPacks_) {
+            delete finalizersPack;
+        }
+        idleFinalizersPacks_.clear();
+        // left only when the loop could not run them
+        for (AsyncNativeCallbacksPack *callbacksPack : pendingCallbackPacks_) {
+            delete callbacksPack;
+        }
+        pendingCallbackPacks_.clear();
         if (JSNApi::IsJSMainThreadOfEcmaVM(vm_)) {
             ArkIdleMonitor::GetInstance()->SetMainThreadEcmaVM(nullptr);
         }
@@ -643,6 +672,7 @@ ArkNativeEngine::~ArkNativeEngine()
     for (auto&& [module, exportObj] : loadedModules_) {
         exportObj.FreeGlobalHandleAddr();
     }
+    propertyKeyCache_.Clear();
     // Free callbackRef
     if (promiseRejectCallbackRef_ != nullptr) {
         delete promiseRejectCallbackRef_;
@@ -657,6 +687,11 @@ ArkNativeEngine::~ArkNativeEngine()
         delete options_;
         options_ = nullptr;
     }
+    // references still alive, e.g. the ones released by the reference manager later, keep the slab alive
+    referenceSlab_->Detach();
+    referenceSlab_ = nullptr;
+    asyncFinalizerQueue_->Detach();
+    asyncFinalizerQueue_ = nullptr;
 }
 
 ArkNativeEngine *ArkNativeEngine::New(NativeEngine* engine, EcmaVM* vm, const Local<JSValueRef>& context)
@@ -1604,7 +1639,7 @@ panda::Local<panda::ObjectRef> ArkNativeEngine::LoadModuleByName(const std::stri
             Local<ObjectRef> object = ObjectRef::NewWrappedNapiObject(vm_);
             NativeReference* ref = nullptr;
             Local<JSValueRef> value(instanceValue);
-            ref = new ArkNativeReference(this, value, 0, true, nullptr, instance, nullptr);
+            ref = new (this) ArkNativeReference(this, value, 0, true, nullptr, instance, nullptr);
 
             object->SetNativePointerFieldCount(vm_, 1);
             object->SetNativePointerField(vm_, 0, ref, nullptr, nullptr, 0);
@@ -2074,20 +2109,36 @@ napi_value ArkNativeEngine::CreateInstance(napi_value constructor, napi_value co
 NativeReference* ArkNativeEngine::CreateReference(napi_value value, uint32_t initialRefcount,
     bool flag, NapiNativeFinalize callback, void* data, void* hint, size_t nativeBindingSize)
 {
-    return new ArkNativeReference(this, value, initialRefcount, flag, callback, data, hint, false, nativeBindingSize);
+    return new (this) ArkNativeReference(this, value, initialRefcount, flag, callback, data, hint, false,
+        nativeBindingSize);
 }
 
 NativeReference* ArkNativeEngine::CreateXRefReference(napi_value value, uint32_t initialRefcount,
     bool flag, NapiNativeFinalize callback, void* data)
 {
     ArkNativeReferenceConfig config(initialRefcount, flag, callback, data);
-    return new ArkXRefNativeReference(this, value, config);
+    return new (this) ArkXRefNativeReference(this, value, config);
 }
 
 NativeReference* ArkNativeEngine::CreateAsyncReference(napi_value value, uint32_t initialRefcount,
     bool flag, NapiNativeFinalize callback, void* data, void* hint)
 {
-    return new ArkNativeReference(this, value, initialRefcount, flag, callback, data, hint, true);
+    return new (this) ArkNativeReference(this, value, initialRefcount, flag, callback, data, hint, true);
+}
+
+bool ArkNativeEngine::CreateReferences(const Local<JSValueRef>* values, size_t count, uint32_t initialRefcount,
+    bool flag, NapiNativeFinalize callback, void* const* data, void* hint, size_t nativeBindingSize,
+    NativeReference** refs)
+{
+    std::vector<void*> slots(count);
+    if (!referenceSlab_->AllocateBatch(sizeof(ArkNativeReference), count, slots.data())) {
+        return false;
+    }
+    for (size_t i = 0; i < count; ++i) {
+        refs[i] = new (slots[i]) ArkNativeReference(this, values[i], initialRefcount, flag, callback, data[i], hint,
+            false, nativeBindingSize);
+    }
+    return true;
 }
 
 __attribute__((optnone)) void ArkNativeEngine::RunCallbacks(TriggerGCData *triggerGCData)
@@ -2120,11 +2171,17 @@ __attribute__((optnone)) void ArkNativeEngine::RunAsyncCallbacks(std::vector<Ref
     StartTrace(HITRACE_TAG_ACE, "RunFinalizeCallbacks:" + std::to_string(finalizers->size()));
 #endif
     INIT_CRASH_HOLDER(holder, "NAPI");
+    NativeFinalizerProfiler &profiler = NativeFinalizerProfiler::GetInstance();
+    bool profiling = profiler.IsEnabled();
     for (auto iter : (*finalizers)) {
         NapiNativeFinalize callback = iter.first;
         std::pair<void*, void*> &param = iter.second;
         holder.UpdateCallbackPtr(reinterpret_cast<uintptr_t>(callback));
+        uint64_t beginNs = profiling ? NativeTaskLatencyRecorder::Now() : 0;
         callback(nullptr, std::get<0>(param), std::get<1>(param)); // 1 is the param.
+        if (profiling) {
+            profiler.Record(reinterpret_cast<const void *>(callback), NativeTaskLatencyRecorder::Now() - beginNs);
+        }
     }
 #ifdef ENABLE_HITRACE
     FinishTrace(HITRACE_TAG_ACE);
@@ -2136,69 +2193,145 @@ void ArkNativeEngine::PostFinalizeTasks()
     if (IsInDestructor()) {
         return;
     }
+    // the gc just ran, its heuristics see the native memory reported since the last flush before the next one
+    FlushExternalMemory();
     if (!pendingAsyncFinalizers_.empty()) {
-        uv_work_t *asynWork = new uv_work_t;
-        std::vector<RefAsyncFinalizer> *asyncFinalizers = new std::vector<RefAsyncFinalizer>();
-        asyncFinalizers->swap(pendingAsyncFinalizers_);
-        asynWork->data = reinterpret_cast<void *>(asyncFinalizers);
-
-        int ret = uv_queue_work_with_qos(GetUVLoop(), asynWork, [](uv_work_t *asynWork) {
-            std::vector<RefAsyncFinalizer> *finalizers =
-                reinterpret_cast<std::vector<RefAsyncFinalizer> *>(asynWork->data);
-            RunAsyncCallbacks(finalizers);
-            HILOG_DEBUG("uv_queue_work async running ");
-            delete finalizers;
-        }, [](uv_work_t *asynWork, int32_t) {
-            delete asynWork;
-        }, uv_qos_t(napi_qos_background));
-        if (ret != 0) {
-            HILOG_ERROR("uv_queue_work fail ret '%{public}d'", ret);
-            RunAsyncCallbacks(asyncFinalizers);
-            delete asynWork;
-            delete asyncFinalizers;
-        }
+        asyncFinalizerQueue_->Post(GetUVLoop(), GetAsyncExecutor(), pendingAsyncFinalizers_);
     }
     if (arkFinalizersPack_.Empty()) {
         return;
     }
-    ArkFinalizersPack *finalizersPack = new ArkFinalizersPack();
-    std::swap(arkFinalizersPack_, *finalizersPack);
     if (!IsMainThread()) {
+        ArkFinalizersPack *finalizersPack = AcquireFinalizersPack();
+        std::swap(arkFinalizersPack_, *finalizersPack);
         panda::JsiNativeScope nativeScope(vm_);
+        uint64_t startNs = NativeTaskLatencyRecorder::Now();
         RunCallbacks(finalizersPack);
-        delete finalizersPack;
+        finalizersPack->RecordWait(finalizerWait_, startNs, 0, finalizersPack->GetNumFinalizers());
+        ReleaseFinalizersPack(finalizersPack);
         return;
     }
-    size_t bindingSize = finalizersPack->GetTotalNativeBindingSize();
-    if (pendingFinalizersPackNativeBindingSize_ > FINALIZERS_PACK_PENDING_NATIVE_BINDING_SIZE_THRESHOLD &&
-        bindingSize > 0) {
+    size_t bindingSize = arkFinalizersPack_.GetTotalNativeBindingSize();
+    bool underPressure = bindingSize > 0 &&
+        pendingFinalizersPackNativeBindingSize_ > FINALIZERS_PACK_PENDING_NATIVE_BINDING_SIZE_THRESHOLD;
+    IncreasePendingFinalizersPackNativeBindingSize(bindingSize);
+    if (finalizerPacks_.empty()) {
+        ArkFinalizersPack *finalizersPack = AcquireFinalizersPack();
+        std::swap(arkFinalizersPack_, *finalizersPack);
+        finalizersPack->RegisterFinishNotify([this] (size_t totalNativeBindingSize) {
+            this->DecreasePendingFinalizersPackNativeBindingSize(totalNativeBindingSize);
+        });
+        finalizerPacks_.push_back(finalizersPack);
+    } else {
+        // the queued pack has not finished, so the flush joins it and the slice already scheduled runs both
+        finalizerPacks_.back()->Append(arkFinalizersPack_);
+    }
+    if (underPressure) {
         HILOG_DEBUG("Pending Finalizers NativeBindingSize '%{public}zu' large than '%{public}zu', process sync.",
             pendingFinalizersPackNativeBindingSize_, FINALIZERS_PACK_PENDING_NATIVE_BINDING_SIZE_THRESHOLD);
         panda::JsiNativeScope nativeScope(vm_);
-        RunCallbacks(finalizersPack);
-        delete finalizersPack;
+        RunFinalizerSlices(UINT64_MAX);
         return;
     }
-    uv_work_t *syncWork = new uv_work_t;
-    finalizersPack->RegisterFinishNotify([this] (size_t totalNativeBindingSize) {
-        this->DecreasePendingFinalizersPackNativeBindingSize(totalNativeBindingSize);
-    });
-    IncreasePendingFinalizersPackNativeBindingSize(bindingSize);
+    ScheduleFinalizerSlice();
+}
 
-    syncWork->data = reinterpret_cast<void *>(finalizersPack);
-    int ret = uv_queue_work_with_qos(GetUVLoop(), syncWork, [](uv_work_t *) {}, [](uv_work_t *syncWork, int32_t) {
-        ArkFinalizersPack *finalizersPack = reinterpret_cast<ArkFinalizersPack*>(syncWork->data);
-        RunCallbacks(finalizersPack);
-        delete syncWork;
+ArkFinalizersPack *ArkNativeEngine::AcquireFinalizersPack()
+{
+    if (idleFinalizersPacks_.empty()) {
+        return new ArkFinalizersPack();
+    }
+    ArkFinalizersPack *finalizersPack = idleFinalizersPacks_.back();
+    idleFinalizersPacks_.pop_back();
+    return finalizersPack;
+}
+
+void ArkNativeEngine::ReleaseFinalizersPack(ArkFinalizersPack *finalizersPack)
+{
+    if (idleFinalizersPacks_.size() >= MAX_IDLE_FINALIZER_PACKS) {
         delete finalizersPack;
+        return;
+    }
+    // the finalizer vector keeps its capacity
+    finalizersPack->Clear();
+    idleFinalizersPacks_.push_back(finalizersPack);
+}
+
+void ArkNativeEngine::ScheduleFinalizerSlice()
+{
+    if (finalizerSliceScheduled_ || finalizerPacks_.empty()) {
+        return;
+    }
+    finalizerSliceWork_ = uv_work_t();
+    finalizerSliceWork_.data = reinterpret_cast<void *>(this);
+    int ret = uv_queue_work_with_qos(GetUVLoop(), &finalizerSliceWork_, [](uv_work_t *) {},
+        [](uv_work_t *sliceWork, int32_t) {
+        ArkNativeEngine *engine = reinterpret_cast<ArkNativeEngine *>(sliceWork->data);
+        engine->finalizerSliceScheduled_ = false;
+        engine->RunFinalizerSlices(NativeTaskLatencyRecorder::Now() + FINALIZER_SLICE_BUDGET_NS);
+        // the rest waits behind the loop events which came in meanwhile, or runs earlier in an idle window
+        engine->ScheduleFinalizerSlice();
     }, uv_qos_t(napi_qos_background));
     if (ret != 0) {
         HILOG_ERROR("uv_queue_work fail ret '%{public}d'", ret);
         panda::JsiNativeScope nativeScope(vm_);
-        RunCallbacks(finalizersPack);
-        delete syncWork;
-        delete finalizersPack;
+        RunFinalizerSlices(UINT64_MAX);
+        return;
     }
+    finalizerSliceScheduled_ = true;
+}
+
+void ArkNativeEngine::RunFinalizerSlices(uint64_t deadlineNs)
+{
+    // a finalizer triggering gc posts new packs, they are picked up by this loop
+    if (runningFinalizerSlices_) {
+        return;
+    }
+    runningFinalizerSlices_ = true;
+    while (!finalizerPacks_.empty()) {
+        if (pendingFinalizersPackNativeBindingSize_ > FINALIZERS_PACK_PENDING_NATIVE_BINDING_SIZE_THRESHOLD) {
+            deadlineNs = UINT64_MAX;
+        }
+        ArkFinalizersPack *finalizersPack = finalizerPacks_.front();
+#ifdef ENABLE_HITRACE
+        StartTrace(HITRACE_TAG_ACE, "RunFinalizeCallbacks:" + std::to_string(finalizersPack->GetNumPending()));
+#endif
+        size_t begin = finalizersPack->GetNumFinalizers() - finalizersPack->GetNumPending();
+        uint64_t startNs = NativeTaskLatencyRecorder::Now();
+        size_t count = finalizersPack->ProcessSlice(deadlineNs);
+        finalizersPack->RecordWait(finalizerWait_, startNs, begin, begin + count);
+#ifdef ENABLE_HITRACE
+        FinishTrace(HITRACE_TAG_ACE);
+#endif
+        if (!finalizersPack->IsFinished()) {
+            break;
+        }
+        finalizerPacks_.pop_front();
+        ReleaseFinalizersPack(finalizersPack);
+        if (NativeTaskLatencyRecorder::Now() >= deadlineNs) {
+            break;
+        }
+    }
+    runningFinalizerSlices_ = false;
+}
+
+void ArkNativeEngine::RunFinalizersInIdle(int idleTimeMs)
+{
+    FlushExternalMemory();
+    if (finalizerPacks_.empty()) {
+        return;
+    }
+    uint64_t budgetNs = std::min(static_cast<uint64_t>(idleTimeMs) * NS_PER_MS / 2, MAX_IDLE_FINALIZER_SLICE_NS);
+    RunFinalizerSlices(NativeTaskLatencyRecorder::Now() + budgetNs);
+}
+
+size_t ArkNativeEngine::GetPendingFinalizerCount() const
+{
+    size_t count = arkFinalizersPack_.GetNumFinalizers();
+    for (const ArkFinalizersPack *finalizersPack : finalizerPacks_) {
+        count += finalizersPack->GetNumPending();
+    }
+    return count;
 }
 
 __attribute__((optnone)) void ArkNativeEngine::RunCallbacks(AsyncNativeCallbacksPack *callbacksPack)
@@ -2218,57 +2351,85 @@ void ArkNativeEngine::PostAsyncTask(AsyncNativeCallbacksPack *callBacksPack)
         delete callBacksPack;
         return;
     }
-    uv_work_t *syncWork = new uv_work_t;
-    syncWork->data = reinterpret_cast<void *>(callBacksPack);
-
-    int ret = uv_queue_work_with_qos(GetUVLoop(), syncWork, [](uv_work_t *) {}, [](uv_work_t *syncWork, int32_t) {
-        AsyncNativeCallbacksPack *finalizers = reinterpret_cast<AsyncNativeCallbacksPack*>(syncWork->data);
-        RunCallbacks(finalizers);
+    pendingCallbackPacks_.push_back(callBacksPack);
+    // packs posted until the work ran, or by its callbacks, are run by the same work
+    if (callbackPacksScheduled_) {
+        return;
+    }
+    callbackPacksScheduled_ = true;
+    callbackPacksWork_ = uv_work_t();
+    callbackPacksWork_.data = reinterpret_cast<void *>(this);
+    int ret = uv_queue_work_with_qos(GetUVLoop(), &callbackPacksWork_, [](uv_work_t *) {},
+        [](uv_work_t *syncWork, int32_t) {
+        reinterpret_cast<ArkNativeEngine *>(syncWork->data)->RunAsyncCallbackPacks();
         HILOG_DEBUG("uv_queue_work running");
-        delete syncWork;
-        delete finalizers;
     }, uv_qos_t(napi_qos_background));
     if (ret != 0) {
         HILOG_ERROR("uv_queue_work fail ret '%{public}d'", ret);
         panda::JsiNativeScope nativeScope(vm_);
-        RunCallbacks(callBacksPack);
-        delete callBacksPack;
-        delete syncWork;
+        RunAsyncCallbackPacks();
     }
 }
 
-class TriggerGCTithCallbackData {
-public:
-    TriggerGCTithCallbackData(TriggerGCData *data, GCTaskFinishedCallback callback)
-        : data_(data), callback_(callback) {}
-
-    TriggerGCData *data_ {nullptr};
-    GCTaskFinishedCallback callback_ {nullptr};
-};
+void ArkNativeEngine::RunAsyncCallbackPacks()
+{
+    for (size_t i = 0; i < pendingCallbackPacks_.size(); ++i) {
+        AsyncNativeCallbacksPack *callbacksPack = pendingCallbackPacks_[i];
+        RunCallbacks(callbacksPack);
+        delete callbacksPack;
+    }
+    // the vector keeps its capacity for the next packs
+    pendingCallbackPacks_.clear();
+    callbackPacksScheduled_ = false;
+}
 
 void ArkNativeEngine::PostTriggerGCTask(TriggerGCData& data, GCTaskFinishedCallback callback)
 {
-    TriggerGCData *triggerGCData = new TriggerGCData(data);
-    TriggerGCTithCallbackData *callbackData = new TriggerGCTithCallbackData(triggerGCData, callback);
-    uv_work_t *syncWork = new uv_work_t;
-    syncWork->data = reinterpret_cast<void *>(callbackData);
-    int ret = uv_queue_work_with_qos(GetUVLoop(), syncWork, [](uv_work_t *) {}, [](uv_work_t *syncWork, int32_t) {
-            auto callbackData = reinterpret_cast<TriggerGCTithCallbackData *>(syncWork->data);
-            auto triggerGCData = reinterpret_cast<TriggerGCData *>(callbackData->data_);
-            RunCallbacks(triggerGCData);
-            if (callbackData->callback_ != nullptr) {
-                callbackData->callback_();
-            }
-            delete callbackData;
-            delete syncWork;
-            delete triggerGCData;
-        }, uv_qos_t(napi_qos_user_initiated));
+    {
+        std::lock_guard<std::mutex> lock(triggerGCMutex_);
+        pendingTriggerGCTasks_.emplace_back(data, std::move(callback));
+        // triggers posted until the work ran, or by its callbacks, are run by the same work
+        if (triggerGCScheduled_) {
+            return;
+        }
+        triggerGCScheduled_ = true;
+    }
+    triggerGCWork_ = uv_work_t();
+    triggerGCWork_.data = reinterpret_cast<void *>(this);
+    int ret = uv_queue_work_with_qos(GetUVLoop(), &triggerGCWork_, [](uv_work_t *) {},
+        [](uv_work_t *syncWork, int32_t) {
+        reinterpret_cast<ArkNativeEngine *>(syncWork->data)->RunTriggerGCTasks();
+    }, uv_qos_t(napi_qos_user_initiated));
     if (ret != 0) {
         HILOG_ERROR("uv_queue_work fail ret '%{public}d'", ret);
-        RunCallbacks(triggerGCData);
-        delete callbackData;
-        delete syncWork;
-        delete triggerGCData;
+        RunTriggerGCTasks();
+    }
+}
+
+void ArkNativeEngine::RunTriggerGCTasks()
+{
+    while (true) {
+        {
+            std::lock_guard<std::mutex> lock(triggerGCMutex_);
+            runningTriggerGCTasks_.swap(pendingTriggerGCTasks_);
+            if (runningTriggerGCTasks_.empty()) {
+                triggerGCScheduled_ = false;
+                return;
+            }
+        }
+        auto begin = runningTriggerGCTasks_.begin();
+        for (auto iter = begin; iter != runningTriggerGCTasks_.end(); ++iter) {
+            // the same gc requested again before the first one ran is only triggered once
+            bool requested = std::any_of(begin, iter, [iter](const auto &task) { return task.first == iter->first; });
+            if (!requested) {
+                RunCallbacks(&iter->first);
+            }
+            if (iter->second != nullptr) {
+                iter->second();
+            }
+        }
+        // the vectors keep their capacity for the next triggers
+        runningTriggerGCTasks_.clear();
     }
 }
 
@@ -3623,7 +3784,7 @@ void ArkNativeEngine::RegisterAllPromiseCallback(NapiAllPromiseRejectCallback ca
         CommonDeleter, reinterpret_cast<void*>(funcInfo), true);
     Local<panda::StringRef> fnName = panda::StringRef::NewFromUtf8(vm_, checkCallbackName.c_str());
     fn->SetName(vm_, fnName);
-    globalCheckCallbackRef_ = new ArkNativeReference(this, JsValueFromLocalValue(fn), 1);
+    globalCheckCallbackRef_ = new (this) ArkNativeReference(this, JsValueFromLocalValue(fn), 1);
 }
 
 void ArkNativeEngine::SetTaskpoolShrinkCallback(TaskPoolShrinkCallback callback)
@@ -21,6 +21,7 @@
 #include <sys/wait.h>
 #include <sys/types.h>
 #endif
+#include <deque>
 #include <iostream>
 #include <map>
 #include <mutex>
@@ -32,8 +33,11 @@
 #include "ark_native_options.h"
 #include "ecmascript/napi/include/dfx_jsnapi.h"
 #include "ecmascript/napi/include/jsnapi.h"
+#include "native_engine/impl/ark/ark_async_finalizer_queue.h"
 #include "native_engine/impl/ark/ark_finalizers_pack.h"
+#include "native_engine/impl/ark/ark_property_key_cache.h"
 #include "native_engine/native_engine.h"
+#include "native_engine/native_slab_allocator.h"
 
 namespace panda::ecmascript {
 struct JsHeapDumpWork;
@@ -229,6 +233,10 @@ public:
         NapiNativeFinalize callback = nullptr, void* data = nullptr);
     NativeReference* CreateAsyncReference(napi_value value, uint32_t initialRefcount, bool flag = false,
         NapiNativeFinalize callback = nullptr, void* data = nullptr, void* hint = nullptr) override;
+    // creates count references like CreateReference with data[i] for values[i], their slots are taken from the
+    // reference slab at once. Returns false without creating any when the slots can not be allocated.
+    bool CreateReferences(const Local<JSValueRef>* values, size_t count, uint32_t initialRefcount, bool flag,
+        NapiNativeFinalize callback, void* const* data, void* hint, size_t nativeBindingSize, NativeReference** refs);
     napi_value CreatePromise(NativeDeferred** deferred) override;
     void* CreateRuntime(bool isLimitedWorker = false) override;
     panda::Local<panda::ObjectRef> LoadArkModule(const void *buffer, int32_t len, const std::string& fileName);
@@ -357,6 +365,33 @@ public:
         return pendingAsyncFinalizers_;
     }
 
+    // finalizers collected but not run yet, including those of a pack run in slices
+    size_t GetPendingFinalizerCount() const;
+
+    size_t GetPendingFinalizersNativeBindingSize() const
+    {
+        return pendingFinalizersPackNativeBindingSize_;
+    }
+
+    // time from a finalizer being queued by the flush after its gc to it running
+    const NativeLatencyHistogram& GetFinalizerWaitHistogram() const
+    {
+        return finalizerWait_;
+    }
+
+    // runs finalizer slices in an idle window of the main thread looper
+    void RunFinalizersInIdle(int idleTimeMs);
+
+    NativeSlabAllocator* GetReferenceSlab() const
+    {
+        return referenceSlab_;
+    }
+
+    ArkPropertyKeyCache& GetPropertyKeyCache()
+    {
+        return propertyKeyCache_;
+    }
+
     void RegisterNapiUncaughtExceptionHandler(NapiUncaughtExceptionCallback callback) override;
     void HandleUncaughtException() override;
     bool HasPendingException() override;
@@ -430,6 +465,14 @@ public:
         panda::Local<panda::ObjectRef>& exportCopy, const std::string& apiPath);
 
     static constexpr size_t FINALIZERS_PACK_PENDING_NATIVE_BINDING_SIZE_THRESHOLD = 500 * 1024 * 1024;  // 500 MB
+    static constexpr size_t MIN_ASYNC_FINALIZERS_PER_TASK = ArkAsyncFinalizerQueue::MIN_FINALIZERS_PER_TASK;
+    static constexpr size_t MAX_ASYNC_FINALIZER_TASKS = ArkAsyncFinalizerQueue::MAX_TASKS_PER_POST;
+    // posted finalizer packs of the js thread kept for reuse once they ran
+    static constexpr size_t MAX_IDLE_FINALIZER_PACKS = 2;
+    // the finalizer packs of the js thread run in slices of this long between other loop events,
+    // idle windows run longer slices of up to half the idle time
+    static constexpr uint64_t FINALIZER_SLICE_BUDGET_NS = 2 * 1000 * 1000;
+    static constexpr uint64_t MAX_IDLE_FINALIZER_SLICE_NS = 8 * 1000 * 1000;
 
     bool IsContainerScopeEnabled() const override
     {
@@ -510,6 +553,13 @@ private:
 
     static void RunCallbacks(ArkFinalizersPack *finalizersPack);
     static void RunAsyncCallbacks(std::vector<RefAsyncFinalizer> *finalizers);
+    ArkFinalizersPack *AcquireFinalizersPack();
+    void ReleaseFinalizersPack(ArkFinalizersPack *finalizersPack);
+    void ScheduleFinalizerSlice();
+    void RunAsyncCallbackPacks();
+    void RunTriggerGCTasks();
+    // runs the queued packs in order until deadlineNs passed, to the end under native memory pressure
+    void RunFinalizerSlices(uint64_t deadlineNs);
     static void RunCallbacks(panda::AsyncNativeCallbacksPack *callbacks);
     static void RunCallbacks(panda::TriggerGCData *triggerGCData);
     static void SetAttribute(bool isLimitedWorker, panda::RuntimeOption &option);
@@ -552,6 +602,7 @@ private:
     NativeReference* promiseRejectCallbackRef_ { nullptr };
     NativeReference* checkCallbackRef_ { nullptr };
     std::map<NativeModule*, panda::Global<panda::JSValueRef>> loadedModules_ {};
+    ArkPropertyKeyCache propertyKeyCache_ { this };
     static PermissionCheckCallback permissionCheckCallback_;
     NapiUncaughtExceptionCallback napiUncaughtExceptionCallback_ { nullptr };
     NapiAllPromiseRejectCallback allPromiseRejectCallback_ {nullptr};
@@ -559,7 +610,30 @@ private:
     bool isLimitedWorker_ = false;
     size_t pendingFinalizersPackNativeBindingSize_ {0};
     ArkFinalizersPack arkFinalizersPack_ {};
+    // posted packs of the js thread, the front one may be partly run
+    std::deque<ArkFinalizersPack *> finalizerPacks_ {};
+    // cleared packs with their capacity, reused by the next flushes
+    std::vector<ArkFinalizersPack *> idleFinalizersPacks_ {};
+    // at most one slice is scheduled at a time, so its work is reused
+    uv_work_t finalizerSliceWork_ {};
+    bool finalizerSliceScheduled_ {false};
+    bool runningFinalizerSlices_ {false};
+    NativeLatencyHistogram finalizerWait_ {};
     std::vector<RefAsyncFinalizer> pendingAsyncFinalizers_ {};
+    // detached rather than deleted on destruction, its tasks may still run on the work pool
+    ArkAsyncFinalizerQueue* asyncFinalizerQueue_ { new ArkAsyncFinalizerQueue(RunAsyncCallbacks) };
+    // async clean packs of the vm posted back to back run in one work, the vectors keep their capacity
+    std::vector<panda::AsyncNativeCallbacksPack *> pendingCallbackPacks_ {};
+    uv_work_t callbackPacksWork_ {};
+    bool callbackPacksScheduled_ {false};
+    // gc triggers can be posted for a worker env from the main thread, so they are guarded
+    std::mutex triggerGCMutex_;
+    std::vector<std::pair<panda::TriggerGCData, GCTaskFinishedCallback>> pendingTriggerGCTasks_ {};
+    std::vector<std::pair<panda::TriggerGCData, GCTaskFinishedCallback>> runningTriggerGCTasks_ {};
+    uv_work_t triggerGCWork_ {};
+    bool triggerGCScheduled_ {false};
+    // detached rather than deleted on destruction, see NativeSlabAllocator
+    NativeSlabAllocator* referenceSlab_ { new NativeSlabAllocator() };
     // napi options and its cache
     NapiOptions* options_ { nullptr };
     // Initialize the default value to false rather than isolating it with macros.
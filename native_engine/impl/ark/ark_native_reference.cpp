@@ -19,6 +19,7 @@
 
 #include "ecmascript/napi/include/jsnapi_expo.h"
 #include "native_engine/native_api_internal.h"
+#include "native_engine/native_reference_sampler.h"
 #include "native_engine/native_utils.h"
 
 ArkNativeReference::ArkNativeReference(ArkNativeEngine* engine,
@@ -65,6 +66,37 @@ ArkNativeReference::ArkNativeReference(ArkNativeEngine* engine,
     ArkNativeReferenceConstructor();
 }
 
+void* ArkNativeReference::operator new(size_t size, ArkNativeEngine* engine) noexcept
+{
+    void* ptr = engine->GetReferenceSlab()->Allocate(size);
+    // the slot must come from a slab for operator delete, and callers did not check the result of a plain new
+    // either, so running out of memory stays fatal rather than constructing into nullptr
+    if (ptr == nullptr) {
+        HILOG_FATAL("allocate reference from slab failed, size: %{public}zu", size);
+    }
+    return ptr;
+}
+
+void ArkNativeReference::operator delete(void* ptr, ArkNativeEngine*) noexcept
+{
+    NativeSlabAllocator::Free(ptr);
+}
+
+void ArkNativeReference::operator delete(void* ptr) noexcept
+{
+    NativeSlabAllocator::Free(ptr);
+}
+
+void* ArkNativeReference::operator new(size_t, void* slot) noexcept
+{
+    return slot;
+}
+
+void ArkNativeReference::operator delete(void* ptr, void*) noexcept
+{
+    NativeSlabAllocator::Free(ptr);
+}
+
 void ArkNativeReference::ArkNativeReferenceConstructor()
 {
     if (napiCallback_ != nullptr) {
@@ -84,16 +116,38 @@ void ArkNativeReference::ArkNativeReferenceConstructor()
         value_.SetWeakCallback(reinterpret_cast<void*>(this), FreeGlobalCallBack, NativeFinalizeCallBack);
     }
 
-    if (ownership_ == ReferenceOwnerShip::RUNTIME) {
-        NativeReferenceManager* referenceManager = engine_->GetReferenceManager();
-        if (referenceManager != nullptr) {
-            referenceManager->CreateHandler(this);
-        }
+    if (napiCallback_ != nullptr) {
+        finalizerKind_ = IsAsyncCall() ? NativeReferenceFinalizer::ASYNC : NativeReferenceFinalizer::SYNC;
+    }
+    NativeReferenceManager* referenceManager = engine_->GetReferenceManager();
+    if (referenceManager != nullptr) {
+        referenceManager->CreateHandler(this);
+    }
+    if (NativeReferenceSampler::GetInstance().ShouldSample()) {
+        RecordSampleSite();
     }
 
     engineId_ = engine_->GetId();
 }
 
+void ArkNativeReference::RecordSampleSite()
+{
+    std::string jsStack;
+    // the js stack can only be walked on the js thread of the engine
+    if (pthread_equal(engine_->GetTid(), pthread_self()) != 0) {
+        engine_->BuildJsStackTrace(jsStack);
+    }
+    sampleSite_ = NativeReferenceSampler::GetInstance().Record(jsStack);
+}
+
+inline void ArkNativeReference::ReleaseSampleSite()
+{
+    if (UNLIKELY(sampleSite_ != 0)) {
+        NativeReferenceSampler::GetInstance().Release(sampleSite_);
+        sampleSite_ = 0;
+    }
+}
+
 uintptr_t ArkNativeReference::GetGlobalRefSlotAddress() const
 {
     return value_.GetSlotAddress();
@@ -115,6 +169,7 @@ inline void ArkNativeReference::InitProperties(bool deleteSelf, bool isAsyncCall
 // Which would occur when EcmaVM is destroying in CleanEnv.
 ArkNativeReference::~ArkNativeReference()
 {
+    ReleaseSampleSite();
     VALID_ENGINE_CHECK(engine_, engine_, engineId_);
 
     if (!napiCallback_) {
@@ -122,10 +177,8 @@ ArkNativeReference::~ArkNativeReference()
     }
 
     NativeReferenceManager* refMgr = engine_->GetReferenceManager();
-    if (ownership_ == ReferenceOwnerShip::RUNTIME && refMgr != nullptr) {
+    if (refMgr != nullptr) {
         refMgr->ReleaseHandler(this);
-        prev_ = nullptr;
-        next_ = nullptr;
     }
     if (value_.IsEmpty()) {
         return;
@@ -285,6 +338,7 @@ void ArkNativeReference::FreeGlobalCallBack(void* ref)
 void ArkNativeReference::NativeFinalizeCallBack(void* ref)
 {
     auto that = reinterpret_cast<ArkNativeReference*>(ref);
+    that->ReleaseSampleSite();
     that->FinalizeCallback(FinalizerState::COLLECTION);
 }
 
@@ -20,6 +20,7 @@
 #include "ecmascript/napi/include/jsnapi.h"
 #include "native_engine/native_reference.h"
 #include "native_engine/native_value.h"
+#include "reference_manager/native_reference_manager.h"
 
 class ArkNativeEngine;
 
@@ -78,6 +79,16 @@ public:
                        size_t nativeBindingSize = 0);
     ~ArkNativeReference() override;
 
+    // references and their subclasses live in the slab of their engine, new (engine) ArkNativeReference(engine, ...),
+    // aborts when the slab can not allocate
+    static void* operator new(size_t size, ArkNativeEngine* engine) noexcept;
+    // only used when a constructor throws
+    static void operator delete(void* ptr, ArkNativeEngine* engine) noexcept;
+    static void operator delete(void* ptr) noexcept;
+    // constructs in a slot taken from the slab of the engine with NativeSlabAllocator::AllocateBatch
+    static void* operator new(size_t size, void* slot) noexcept;
+    static void operator delete(void* ptr, void* slot) noexcept;
+
     uint32_t Ref() override;
     uint32_t Unref() override;
     napi_value Get() override;
@@ -134,20 +145,26 @@ protected:
     // Bit-packed flags: saves memory and speeds up object creation vs. multiple bools.
     // std::bitset will use more memory than uint8_t number.
     uint8_t properties_ {0};
+    // decided at creation so the reference manager counts it the same on release
+    NativeReferenceFinalizer finalizerKind_ {NativeReferenceFinalizer::NONE};
 
     NapiNativeFinalize napiCallback_ {nullptr};
     void* data_ {nullptr};
     void* hint_ {nullptr};
     size_t nativeBindingSize_ {0};
 
-    NativeReference* prev_ {nullptr};
-    NativeReference* next_ {nullptr};
+    // slot in the reference manager, only meaningful for runtime owned references
+    uint32_t managerIndex_ {0};
+    // allocation site in NativeReferenceSampler while the reference is sampled and its object alive, otherwise 0
+    uint32_t sampleSite_ {0};
 
     bool IsAsyncCall() const;
     bool HasDelete() const;
     void SetHasDelete();
     void SetFinalRan();
 
+    void RecordSampleSite();
+    void ReleaseSampleSite();
     void FinalizeCallback(FinalizerState state);
     void DispatchFinalizeCallback();
     void EnqueueAsyncTask();
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ark_property_key_cache.h"
+
+ArkPropertyKey* ArkPropertyKeyCache::Lookup(const EcmaVM* vm, const char* utf8name)
+{
+    std::string_view name(utf8name);
+    auto it = keys_.find(name);
+    if (it != keys_.end()) {
+        hits_++;
+        ArkPropertyKey* key = it->second.get();
+        if (!key->pinned) {
+            lru_.splice(lru_.begin(), lru_, key->lruPos);
+        }
+        return key;
+    }
+    misses_++;
+    // long names are mostly built at runtime and seldom seen again
+    if (name.size() > MAX_IMPLICIT_KEY_LENGTH) {
+        return nullptr;
+    }
+    if (lru_.size() >= MAX_IMPLICIT_KEYS) {
+        EvictLeastRecentlyUsed();
+    }
+    ArkPropertyKey* key = Insert(vm, name);
+    lru_.push_front(key);
+    key->lruPos = lru_.begin();
+    return key;
+}
+
+ArkPropertyKey* ArkPropertyKeyCache::Intern(const EcmaVM* vm, std::string_view name)
+{
+    auto it = keys_.find(name);
+    if (it == keys_.end()) {
+        ArkPropertyKey* key = Insert(vm, name);
+        key->pinned = true;
+        return key;
+    }
+    ArkPropertyKey* key = it->second.get();
+    // a name interned by a named property call becomes a handle, it leaves the lru list for good
+    if (!key->pinned) {
+        lru_.erase(key->lruPos);
+        key->pinned = true;
+    }
+    return key;
+}
+
+ArkPropertyKey* ArkPropertyKeyCache::Insert(const EcmaVM* vm, std::string_view name)
+{
+    auto key = std::make_unique<ArkPropertyKey>();
+    key->name.assign(name.data(), name.size());
+    key->engine = engine_;
+    key->value = panda::Global<panda::StringRef>(vm,
+        panda::StringRef::NewFromUtf8(vm, key->name.c_str(), key->name.size()));
+    ArkPropertyKey* result = key.get();
+    keys_.emplace(std::string_view(result->name), std::move(key));
+    return result;
+}
+
+void ArkPropertyKeyCache::EvictLeastRecentlyUsed()
+{
+    ArkPropertyKey* key = lru_.back();
+    lru_.pop_back();
+    key->value.FreeGlobalHandleAddr();
+    // erased by iterator, the map key views the name of the key it destroys
+    keys_.erase(keys_.find(std::string_view(key->name)));
+}
+
+void ArkPropertyKeyCache::Clear()
+{
+    for (auto& [name, key] : keys_) {
+        key->value.FreeGlobalHandleAddr();
+    }
+    keys_.clear();
+    lru_.clear();
+}
+
+void ArkPropertyKeyCache::GetStats(ArkPropertyKeyCacheStats& stats) const
+{
+    stats.hits = hits_;
+    stats.misses = misses_;
+    stats.keys = keys_.size();
+}
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_NAPI_NATIVE_ENGINE_ARK_PROPERTY_KEY_CACHE_H
+#define FOUNDATION_ACE_NAPI_NATIVE_ENGINE_ARK_PROPERTY_KEY_CACHE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "ecmascript/napi/include/jsnapi.h"
+
+class NativeEngine;
+
+struct ArkPropertyKey {
+    std::string name;
+    panda::Global<panda::StringRef> value;
+    // the engine whose cache interned the key, the only one the key may be used with
+    const NativeEngine* engine = nullptr;
+    // keys of napi_create_property_key are handles and never evicted, the others sit in the lru list of the cache
+    bool pinned = false;
+    std::list<ArkPropertyKey*>::iterator lruPos;
+};
+
+struct ArkPropertyKeyCacheStats {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    size_t keys = 0;
+};
+
+/*
+ * Property names of an engine interned as vm strings held by global handles, so named property access with a name
+ * seen before costs a hash of its bytes instead of the utf8 decoding and string table lookup of a new StringRef.
+ * Names of named property calls of at most MAX_IMPLICIT_KEY_LENGTH bytes are interned, past MAX_IMPLICIT_KEYS the
+ * least recently used of them makes room for the new one, so the cache follows the names in use. Keys made by
+ * napi_create_property_key do not count against the limit and live until the engine is destroyed, their address is
+ * the napi_property_key handle. Js thread only.
+ */
+class ArkPropertyKeyCache {
+public:
+    static constexpr size_t MAX_IMPLICIT_KEYS = 256;
+    static constexpr size_t MAX_IMPLICIT_KEY_LENGTH = 64;
+
+    explicit ArkPropertyKeyCache(const NativeEngine* engine) : engine_(engine) {}
+    ~ArkPropertyKeyCache() = default;
+
+    ArkPropertyKeyCache(const ArkPropertyKeyCache&) = delete;
+    ArkPropertyKeyCache& operator=(const ArkPropertyKeyCache&) = delete;
+
+    // the key of a named property call, interned on a miss, nullptr when it is not cached. The key is valid until the
+    // next Lookup, which may evict it
+    ArkPropertyKey* Lookup(const EcmaVM* vm, const char* utf8name);
+    // the key of napi_create_property_key, always interned and pinned
+    ArkPropertyKey* Intern(const EcmaVM* vm, std::string_view name);
+    // frees the handles while the vm is alive, the keys handed out are invalid afterwards
+    void Clear();
+    void GetStats(ArkPropertyKeyCacheStats& stats) const;
+
+private:
+    ArkPropertyKey* Insert(const EcmaVM* vm, std::string_view name);
+    void EvictLeastRecentlyUsed();
+
+    const NativeEngine* engine_ = nullptr;
+    // the views point to the names of the keys
+    std::unordered_map<std::string_view, std::unique_ptr<ArkPropertyKey>> keys_;
+    // keys which are not pinned, most recently used first
+    std::list<ArkPropertyKey*> lru_;
+    uint64_t hits_ = 0;
+    uint64_t misses_ = 0;
+};
+
+#endif /* FOUNDATION_ACE_NAPI_NATIVE_ENGINE_ARK_PROPERTY_KEY_CACHE_H */
@@ -21,6 +21,21 @@ ArkSendableNativeReference::ArkSendableNativeReference(ArkNativeEngine* engine,
     : value_(engine->GetEcmaVm(), value)
 {}
 
+void* ArkSendableNativeReference::operator new(size_t size, ArkNativeEngine* engine) noexcept
+{
+    return engine->GetReferenceSlab()->Allocate(size);
+}
+
+void ArkSendableNativeReference::operator delete(void* ptr, ArkNativeEngine*) noexcept
+{
+    NativeSlabAllocator::Free(ptr);
+}
+
+void ArkSendableNativeReference::operator delete(void* ptr) noexcept
+{
+    NativeSlabAllocator::Free(ptr);
+}
+
 void ArkSendableNativeReference::DeleteSendableRef(ArkNativeEngine* engine)
 {
     std::lock_guard<std::mutex> lock(mutex_);
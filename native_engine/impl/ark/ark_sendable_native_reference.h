@@ -28,6 +28,14 @@ class ArkSendableNativeReference {
 public:
     ArkSendableNativeReference(ArkNativeEngine* engine, panda::Local<JSValueRef> value);
     ~ArkSendableNativeReference() = default;
+
+    // allocated from the reference slab of the engine, new (engine) ArkSendableNativeReference(engine, value)
+    static void* operator new(size_t size, ArkNativeEngine* engine) noexcept;
+    // only used when the constructor throws
+    static void operator delete(void* ptr, ArkNativeEngine* engine) noexcept;
+    // can be called from any thread, also once the engine is gone
+    static void operator delete(void* ptr) noexcept;
+
     void DeleteSendableRef(ArkNativeEngine* engine);
     napi_value Get(ArkNativeEngine* engine);
 private:
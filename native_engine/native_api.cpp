@@ -26,6 +26,11 @@
 #include "native_engine/worker_manager.h"
 #include "securec.h"
 #include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <set>
+#include <string_view>
+#include <vector>
 
 #ifdef ENABLE_CONTAINER_SCOPE
 #include "native_engine/native_container_scope.h"
@@ -1226,6 +1231,18 @@ NAPI_EXTERN napi_status napi_has_own_property(napi_env env, napi_value object, n
     return GET_RETURN_STATUS(env);
 }
 
+// the interned key of utf8name, nullptr when it is not cached, see ArkPropertyKeyCache
+static inline ArkPropertyKey* LookupPropertyKey(napi_env env, const EcmaVM* vm, const char* utf8name)
+{
+    return reinterpret_cast<ArkNativeEngine*>(env)->GetPropertyKeyCache().Lookup(vm, utf8name);
+}
+
+// a key holds its name in the global handles of the engine which interned it, so it is rejected on any other env
+static inline bool IsPropertyKeyOf(napi_env env, const ArkPropertyKey* key)
+{
+    return key->engine == reinterpret_cast<NativeEngine*>(env);
+}
+
 NAPI_EXTERN napi_status napi_set_named_property(napi_env env, napi_value object, const char* utf8name, napi_value value)
 {
     NAPI_PREAMBLE(env);
@@ -1241,7 +1258,12 @@ NAPI_EXTERN napi_status napi_set_named_property(napi_env env, napi_value object,
     RETURN_STATUS_IF_FALSE(env, nativeValue->IsObjectWithoutSwitchState(vm) || nativeValue->IsFunction(vm),
         napi_object_expected);
     Local<panda::ObjectRef> obj(nativeValue);
-    obj->SetWithoutSwitchState(vm, utf8name, propVal);
+    ArkPropertyKey* key = LookupPropertyKey(env, vm, utf8name);
+    if (key != nullptr) {
+        obj->SetWithoutSwitchState(vm, Local<panda::JSValueRef>(key->value.ToLocal(vm)), propVal);
+    } else {
+        obj->SetWithoutSwitchState(vm, utf8name, propVal);
+    }
 
     return GET_RETURN_STATUS(env);
 }
@@ -1258,7 +1280,9 @@ NAPI_EXTERN napi_status napi_has_named_property(napi_env env, napi_value object,
     auto vm = reinterpret_cast<NativeEngine*>(env)->GetEcmaVm();
     panda::JsiFastNativeScope fastNativeScope(vm);
     CHECK_AND_CONVERT_TO_OBJECT(env, vm, nativeValue, obj);
-    Local<panda::StringRef> key = panda::StringRef::NewFromUtf8(vm, utf8name);
+    ArkPropertyKey* cachedKey = LookupPropertyKey(env, vm, utf8name);
+    Local<panda::StringRef> key = cachedKey != nullptr ? cachedKey->value.ToLocal(vm) :
+        panda::StringRef::NewFromUtf8(vm, utf8name);
     *result = obj->Has(vm, key);
 
     return GET_RETURN_STATUS(env);
@@ -1277,7 +1301,101 @@ NAPI_EXTERN napi_status napi_get_named_property(napi_env env,
     SWITCH_CONTEXT(env);
     auto vm = reinterpret_cast<NativeEngine*>(env)->GetEcmaVm();
     panda::JsiFastNativeScope fastNativeScope(vm);
-    Local<panda::JSValueRef> value = JSNApi::NapiGetNamedProperty(vm, reinterpret_cast<uintptr_t>(object), utf8name);
+    ArkPropertyKey* key = LookupPropertyKey(env, vm, utf8name);
+    Local<panda::JSValueRef> value = key != nullptr ?
+        JSNApi::NapiGetProperty(vm, reinterpret_cast<uintptr_t>(object),
+                                reinterpret_cast<uintptr_t>(JsValueFromLocalValue(key->value.ToLocal(vm)))) :
+        JSNApi::NapiGetNamedProperty(vm, reinterpret_cast<uintptr_t>(object), utf8name);
+    RETURN_STATUS_IF_FALSE(env, NapiStatusValidationCheck(value), napi_object_expected);
+#ifdef ENABLE_CONTAINER_SCOPE
+    FunctionSetContainerId(env, value);
+#endif
+    *result = JsValueFromLocalValue(value);
+
+    return GET_RETURN_STATUS(env);
+}
+
+NAPI_EXTERN napi_status napi_create_property_key(napi_env env,
+                                                 const char* utf8name,
+                                                 size_t length,
+                                                 napi_property_key* result)
+{
+    CHECK_ENV(env);
+    CHECK_ARG(env, utf8name);
+    CHECK_ARG(env, result);
+
+    auto vm = reinterpret_cast<NativeEngine*>(env)->GetEcmaVm();
+    std::string_view name(utf8name, length == NAPI_AUTO_LENGTH ? strlen(utf8name) : length);
+    ArkPropertyKey* key = reinterpret_cast<ArkNativeEngine*>(env)->GetPropertyKeyCache().Intern(vm, name);
+    *result = reinterpret_cast<napi_property_key>(key);
+
+    return napi_clear_last_error(env);
+}
+
+NAPI_EXTERN napi_status napi_set_property_by_key(napi_env env,
+                                                 napi_value object,
+                                                 napi_property_key key,
+                                                 napi_value value)
+{
+    NAPI_PREAMBLE(env);
+    CHECK_ARG(env, object);
+    CHECK_ARG(env, key);
+    CHECK_ARG(env, value);
+    auto propertyKey = reinterpret_cast<ArkPropertyKey*>(key);
+    RETURN_STATUS_IF_FALSE(env, IsPropertyKeyOf(env, propertyKey), napi_invalid_arg);
+
+    auto nativeValue = LocalValueFromJsValue(object);
+    auto propVal = LocalValueFromJsValue(value);
+    SWITCH_CONTEXT(env);
+    auto vm = reinterpret_cast<NativeEngine*>(env)->GetEcmaVm();
+    panda::JsiFastNativeScope fastNativeScope(vm);
+    RETURN_STATUS_IF_FALSE(env, nativeValue->IsObjectWithoutSwitchState(vm) || nativeValue->IsFunction(vm),
+        napi_object_expected);
+    Local<panda::ObjectRef> obj(nativeValue);
+    obj->SetWithoutSwitchState(vm, Local<panda::JSValueRef>(propertyKey->value.ToLocal(vm)), propVal);
+
+    return GET_RETURN_STATUS(env);
+}
+
+NAPI_EXTERN napi_status napi_has_property_by_key(napi_env env,
+                                                 napi_value object,
+                                                 napi_property_key key,
+                                                 bool* result)
+{
+    NAPI_PREAMBLE(env);
+    CHECK_ARG(env, object);
+    CHECK_ARG(env, key);
+    CHECK_ARG(env, result);
+    auto propertyKey = reinterpret_cast<ArkPropertyKey*>(key);
+    RETURN_STATUS_IF_FALSE(env, IsPropertyKeyOf(env, propertyKey), napi_invalid_arg);
+
+    auto nativeValue = LocalValueFromJsValue(object);
+    SWITCH_CONTEXT(env);
+    auto vm = reinterpret_cast<NativeEngine*>(env)->GetEcmaVm();
+    panda::JsiFastNativeScope fastNativeScope(vm);
+    CHECK_AND_CONVERT_TO_OBJECT(env, vm, nativeValue, obj);
+    *result = obj->Has(vm, propertyKey->value.ToLocal(vm));
+
+    return GET_RETURN_STATUS(env);
+}
+
+NAPI_EXTERN napi_status napi_get_property_by_key(napi_env env,
+                                                 napi_value object,
+                                                 napi_property_key key,
+                                                 napi_value* result)
+{
+    NAPI_PREAMBLE(env);
+    CHECK_ARG(env, object);
+    CHECK_ARG(env, key);
+    CHECK_ARG(env, result);
+    auto propertyKey = reinterpret_cast<ArkPropertyKey*>(key);
+    RETURN_STATUS_IF_FALSE(env, IsPropertyKeyOf(env, propertyKey), napi_invalid_arg);
+
+    SWITCH_CONTEXT(env);
+    auto vm = reinterpret_cast<NativeEngine*>(env)->GetEcmaVm();
+    panda::JsiFastNativeScope fastNativeScope(vm);
+    Local<panda::JSValueRef> value = JSNApi::NapiGetProperty(vm, reinterpret_cast<uintptr_t>(object),
+        reinterpret_cast<uintptr_t>(JsValueFromLocalValue(propertyKey->value.ToLocal(vm))));
     RETURN_STATUS_IF_FALSE(env, NapiStatusValidationCheck(value), napi_object_expected);
 #ifdef ENABLE_CONTAINER_SCOPE
     FunctionSetContainerId(env, value);
@@ -1287,6 +1405,19 @@ NAPI_EXTERN napi_status napi_get_named_property(napi_env env,
     return GET_RETURN_STATUS(env);
 }
 
+NAPI_EXTERN napi_status napi_get_property_key_cache_stats(napi_env env, napi_property_key_cache_stats* stats)
+{
+    CHECK_ENV(env);
+    CHECK_ARG(env, stats);
+
+    ArkPropertyKeyCacheStats cacheStats;
+    reinterpret_cast<ArkNativeEngine*>(env)->GetPropertyKeyCache().GetStats(cacheStats);
+    stats->hits = cacheStats.hits;
+    stats->misses = cacheStats.misses;
+    stats->keys = cacheStats.keys;
+    return napi_clear_last_error(env);
+}
+
 NAPI_EXTERN napi_status napi_get_own_property_descriptor(napi_env env,
                                                          napi_value object,
                                                          const char* utf8name,
@@ -2144,6 +2275,95 @@ NAPI_EXTERN napi_status napi_map_iterator_get_next(napi_env env, napi_value iter
     return GET_RETURN_STATUS(env);
 }
 
+// An object wrapped in place keeps the reference in its native pointer field 0, this tag in field 1 and its type tag
+// in field 2, the tag tells it from objects whose native pointer fields belong to someone else
+static char g_directWrapTag = 0;
+// set once some env wrapped in place, until then unwrap and remove only look for the wrapper object
+static std::atomic<bool> g_directWrapUsed { false };
+static constexpr int32_t DIRECT_WRAP_FIELD_COUNT = 3;
+static constexpr int32_t DIRECT_WRAP_TYPE_TAG_FIELD = 2;
+
+static inline bool IsWrappedInPlace(const EcmaVM* vm, const Local<ObjectRef>& object)
+{
+    return !object->IsProxy(vm) && object->GetNativePointerFieldCount(vm) == DIRECT_WRAP_FIELD_COUNT &&
+        object->GetNativePointerField(vm, 1) == &g_directWrapTag;
+}
+
+bool IsObjectWrappedInPlace(const EcmaVM* vm, const Local<ObjectRef>& object)
+{
+    return g_directWrapUsed.load(std::memory_order_relaxed) && IsWrappedInPlace(vm, object);
+}
+
+// proxies and sendable objects can not hold the fields, objects wrapped by a wrapper object stay so
+static inline bool CanWrapInPlace(NativeEngine* engine,
+                                  const EcmaVM* vm,
+                                  const Local<ObjectRef>& object,
+                                  const Local<StringRef>& key)
+{
+    return engine->IsDirectWrapEnabled() && !object->IsProxy(vm) && !object->IsSendableObject(vm) &&
+        object->GetNativePointerFieldCount(vm) == 0 && !object->Has(vm, key);
+}
+
+static void PrepareInPlace(const EcmaVM* vm, const Local<ObjectRef>& object)
+{
+    g_directWrapUsed.store(true, std::memory_order_relaxed);
+    object->SetNativePointerFieldCount(vm, DIRECT_WRAP_FIELD_COUNT);
+    object->SetNativePointerField(vm, 1, &g_directWrapTag, nullptr, nullptr, 0);
+}
+
+// type tags stored in place point to a process wide copy, as the caller's tag may not outlive the object. There are
+// as many copies as distinct tags, which are usually constants of the native classes.
+static const NapiTypeTag* InternTypeTag(const NapiTypeTag* typeTag)
+{
+    static std::mutex mutex;
+    static std::set<std::pair<uint64_t, uint64_t>> tags;
+    std::lock_guard<std::mutex> lock(mutex);
+    // set nodes never move, the copy is a lower and upper word pair just like NapiTypeTag
+    static_assert(sizeof(NapiTypeTag) == sizeof(std::pair<uint64_t, uint64_t>));
+    auto iter = tags.emplace(typeTag->lower, typeTag->upper).first;
+    return reinterpret_cast<const NapiTypeTag*>(&(*iter));
+}
+
+// Keeps ref on the target itself when env wraps in place and the target can hold native pointer fields, otherwise
+// on a wrapper object defined under key. A target wrapped or type tagged in place before stays so, the new ref
+// replaces the old.
+static void AttachWrapReference(NativeEngine* engine,
+                                const EcmaVM* vm,
+                                const Local<ObjectRef>& nativeObject,
+                                const Local<StringRef>& key,
+                                NativeReference* ref,
+                                size_t nativeBindingSize)
+{
+    bool wrapped = g_directWrapUsed.load(std::memory_order_relaxed) && IsWrappedInPlace(vm, nativeObject);
+    if (wrapped || CanWrapInPlace(engine, vm, nativeObject, key)) {
+        if (!wrapped) {
+            PrepareInPlace(vm, nativeObject);
+        }
+        nativeObject->SetNativePointerField(vm, 0, ref, nullptr, nullptr, nativeBindingSize);
+        return;
+    }
+    Local<ObjectRef> object = ObjectRef::NewWrappedNapiObject(vm);
+    object->SetNativePointerFieldCount(vm, 1);
+    object->SetNativePointerField(vm, 0, ref, nullptr, nullptr, nativeBindingSize);
+    PropertyAttribute attr(object, true, false, true);
+    nativeObject->DefineProperty(vm, key, attr);
+}
+
+static inline void* GetWrappedData(const EcmaVM* vm, const Local<ObjectRef>& object, const Local<StringRef>& key)
+{
+    if (UNLIKELY(g_directWrapUsed.load(std::memory_order_relaxed)) && IsWrappedInPlace(vm, object)) {
+        auto ref = reinterpret_cast<NativeReference*>(object->GetNativePointerField(vm, 0));
+        return ref != nullptr ? ref->GetData() : nullptr;
+    }
+    Local<panda::JSValueRef> val = object->Get(vm, key);
+    if (val->IsObjectWithoutSwitchState(vm)) {
+        Local<panda::ObjectRef> ext(val);
+        auto ref = reinterpret_cast<NativeReference*>(ext->GetNativePointerField(vm, 0));
+        return ref != nullptr ? ref->GetData() : nullptr;
+    }
+    return nullptr;
+}
+
 // Methods to work with external data objects
 NAPI_EXTERN napi_status napi_wrap(napi_env env,
                                   napi_value js_object,
@@ -2169,7 +2389,6 @@ NAPI_EXTERN napi_status napi_wrap(napi_env env,
     if (nativeObject->Has(vm, key)) {
         HILOG_DEBUG("napi_wrap: current js_object has been wrapped.");
     }
-    Local<panda::ObjectRef> object = panda::ObjectRef::NewWrappedNapiObject(vm);
     NativeReference* ref = nullptr;
     if (reference != nullptr) {
         ref = engine->CreateReference(js_object, 1, false, callback, native_object, finalize_hint);
@@ -2177,10 +2396,7 @@ NAPI_EXTERN napi_status napi_wrap(napi_env env,
     } else {
         ref = engine->CreateReference(js_object, 0, true, callback, native_object, finalize_hint);
     }
-    object->SetNativePointerFieldCount(vm, 1);
-    object->SetNativePointerField(vm, 0, ref, nullptr, nullptr, nativeBindingSize);
-    PropertyAttribute attr(object, true, false, true);
-    nativeObject->DefineProperty(vm, key, attr);
+    AttachWrapReference(engine, vm, nativeObject, key, ref, nativeBindingSize);
     return GET_RETURN_STATUS(env);
 }
 
@@ -2206,7 +2422,6 @@ NAPI_EXTERN napi_status napi_wrap_enhance(napi_env env,
     CHECK_AND_CONVERT_TO_OBJECT(env, vm, nativeValue, nativeObject);
     auto reference = reinterpret_cast<NativeReference**>(result);
     Local<panda::StringRef> key = panda::StringRef::GetNapiWrapperString(vm);
-    Local<panda::ObjectRef> object = panda::ObjectRef::NewWrappedNapiObject(vm);
     NativeReference* ref = nullptr;
     if (!async_finalizer) {
         if (reference != nullptr) {
@@ -2225,11 +2440,7 @@ NAPI_EXTERN napi_status napi_wrap_enhance(napi_env env,
             ref = engine->CreateAsyncReference(js_object, 0, true, callback, native_object, finalize_hint);
         }
     }
-    object->SetNativePointerFieldCount(vm, 1);
-    object->SetNativePointerField(vm, 0, ref, nullptr, nullptr, native_binding_size);
-
-    PropertyAttribute attr(object, true, false, true);
-    nativeObject->DefineProperty(vm, key, attr);
+    AttachWrapReference(engine, vm, nativeObject, key, ref, native_binding_size);
     return GET_RETURN_STATUS(env);
 }
 
@@ -2257,7 +2468,6 @@ NAPI_EXTERN napi_status napi_wrap_async_finalizer(napi_env env,
     if (nativeObject->Has(vm, key)) {
         HILOG_DEBUG("napi_wrap_async_finalizer: current js_object has been wrapped.");
     }
-    Local<panda::ObjectRef> object = panda::ObjectRef::NewWrappedNapiObject(vm);
     NativeReference* ref = nullptr;
     if (reference != nullptr) {
         ref = engine->CreateAsyncReference(js_object, 1, false, callback, native_object, finalize_hint);
@@ -2265,10 +2475,7 @@ NAPI_EXTERN napi_status napi_wrap_async_finalizer(napi_env env,
     } else {
         ref = engine->CreateAsyncReference(js_object, 0, true, callback, native_object, finalize_hint);
     }
-    object->SetNativePointerFieldCount(vm, 1);
-    object->SetNativePointerField(vm, 0, ref, nullptr, nullptr, native_binding_size);
-    PropertyAttribute attr(object, true, false, true);
-    nativeObject->DefineProperty(vm, key, attr);
+    AttachWrapReference(engine, vm, nativeObject, key, ref, native_binding_size);
     return GET_RETURN_STATUS(env);
 }
 
@@ -2296,7 +2503,6 @@ NAPI_EXTERN napi_status napi_wrap_with_size(napi_env env,
     if (nativeObject->Has(vm, key)) {
         HILOG_DEBUG("napi_wrap_with_size: current js_object has been wrapped.");
     }
-    Local<panda::ObjectRef> object = panda::ObjectRef::NewWrappedNapiObject(vm);
     NativeReference* ref = nullptr;
     if (reference != nullptr) {
         ref = engine->CreateReference(js_object, 1, false, callback, native_object, finalize_hint,
@@ -2306,10 +2512,7 @@ NAPI_EXTERN napi_status napi_wrap_with_size(napi_env env,
         ref = engine->CreateReference(js_object, 0, true, callback, native_object, finalize_hint,
                                       native_binding_size);
     }
-    object->SetNativePointerFieldCount(vm, 1);
-    object->SetNativePointerField(vm, 0, ref, nullptr, nullptr, native_binding_size);
-    PropertyAttribute attr(object, true, false, true);
-    nativeObject->DefineProperty(vm, key, attr);
+    AttachWrapReference(engine, vm, nativeObject, key, ref, native_binding_size);
 
     return GET_RETURN_STATUS(env);
 }
@@ -2326,14 +2529,120 @@ NAPI_EXTERN napi_status napi_unwrap(napi_env env, napi_value js_object, void** r
     panda::JsiFastNativeScope fastNativeScope(vm);
     CHECK_AND_CONVERT_TO_OBJECT_HOTPOT_OPT(env, vm, nativeValue, nativeObject);
     Local<panda::StringRef> key = panda::StringRef::GetNapiWrapperString(vm);
-    Local<panda::JSValueRef> val = nativeObject->Get(vm, key);
-    *result = nullptr;
-    if (val->IsObjectWithoutSwitchState(vm)) {
-        Local<panda::ObjectRef> ext(val);
-        auto ref = reinterpret_cast<NativeReference*>(ext->GetNativePointerField(vm, 0));
-        *result = ref != nullptr ? ref->GetData() : nullptr;
+    *result = GetWrappedData(vm, nativeObject, key);
+
+    return GET_RETURN_STATUS(env);
+}
+
+// the objects of a batch, the first count elements of jsArray or jsObjects, every one an object or a function
+static napi_status CollectBatchObjects(const EcmaVM* vm,
+                                       napi_value jsArray,
+                                       const napi_value* jsObjects,
+                                       size_t count,
+                                       std::vector<Local<panda::JSValueRef>>& objects)
+{
+    objects.reserve(count);
+    if (jsArray != nullptr) {
+        Local<panda::JSValueRef> arrayValue = LocalValueFromJsValue(jsArray);
+        if (!arrayValue->IsJSArray(vm)) {
+            return napi_array_expected;
+        }
+        Local<panda::ArrayRef> array(arrayValue);
+        if (count > array->Length(vm)) {
+            return napi_invalid_arg;
+        }
+        for (size_t i = 0; i < count; ++i) {
+            objects.emplace_back(array->Get(vm, static_cast<uint32_t>(i)));
+        }
+    } else {
+        for (size_t i = 0; i < count; ++i) {
+            if (jsObjects[i] == nullptr) {
+                return napi_invalid_arg;
+            }
+            objects.emplace_back(LocalValueFromJsValue(jsObjects[i]));
+        }
+    }
+    for (auto& object : objects) {
+        if (object->IsObjectWithoutSwitchState(vm)) {
+            continue;
+        }
+        if (!object->IsFunction(vm)) {
+            return napi_object_expected;
+        }
+        object = object->ToEcmaObjectWithoutSwitchState(vm);
     }
+    return napi_ok;
+}
 
+NAPI_EXTERN napi_status napi_wrap_batch(napi_env env,
+                                        napi_value js_array,
+                                        const napi_value* js_objects,
+                                        size_t count,
+                                        void* const* native_objects,
+                                        napi_finalize finalize_cb,
+                                        void* finalize_hint,
+                                        size_t native_binding_size,
+                                        napi_ref* results)
+{
+    NAPI_PREAMBLE(env);
+    RETURN_STATUS_IF_FALSE(env, (js_array == nullptr) != (js_objects == nullptr), napi_invalid_arg);
+    CHECK_ARG(env, native_objects);
+    CHECK_ARG(env, finalize_cb);
+
+    auto callback = reinterpret_cast<NapiNativeFinalize>(finalize_cb);
+    SWITCH_CONTEXT(env);
+    auto vm = engine->GetEcmaVm();
+    panda::JsiFastNativeScope fastNativeScope(vm);
+    panda::LocalScope scope(vm);
+    std::vector<Local<panda::JSValueRef>> objects;
+    napi_status status = CollectBatchObjects(vm, js_array, js_objects, count, objects);
+    if (status != napi_ok) {
+        return napi_set_last_error(env, status);
+    }
+    for (size_t i = 0; i < count; ++i) {
+        CHECK_ARG(env, native_objects[i]);
+    }
+
+    // wraps without result are runtime owned, like napi_wrap
+    std::vector<NativeReference*> refs(results == nullptr ? count : 0);
+    NativeReference** created = results != nullptr ? reinterpret_cast<NativeReference**>(results) : refs.data();
+    bool userOwned = results != nullptr;
+    if (!reinterpret_cast<ArkNativeEngine*>(engine)->CreateReferences(objects.data(), count, userOwned ? 1 : 0,
+        !userOwned, callback, native_objects, finalize_hint, native_binding_size, created)) {
+        return napi_set_last_error(env, napi_generic_failure);
+    }
+    Local<panda::StringRef> key = panda::StringRef::GetNapiWrapperString(vm);
+    for (size_t i = 0; i < count; ++i) {
+        Local<panda::ObjectRef> object(objects[i]);
+        AttachWrapReference(engine, vm, object, key, created[i], native_binding_size);
+    }
+    return GET_RETURN_STATUS(env);
+}
+
+NAPI_EXTERN napi_status napi_unwrap_batch(napi_env env,
+                                          napi_value js_array,
+                                          const napi_value* js_objects,
+                                          size_t count,
+                                          void** results)
+{
+    NAPI_PREAMBLE(env);
+    RETURN_STATUS_IF_FALSE(env, (js_array == nullptr) != (js_objects == nullptr), napi_invalid_arg);
+    CHECK_ARG(env, results);
+
+    SWITCH_CONTEXT(env);
+    auto vm = engine->GetEcmaVm();
+    panda::JsiFastNativeScope fastNativeScope(vm);
+    panda::LocalScope scope(vm);
+    std::vector<Local<panda::JSValueRef>> objects;
+    napi_status status = CollectBatchObjects(vm, js_array, js_objects, count, objects);
+    if (status != napi_ok) {
+        return napi_set_last_error(env, status);
+    }
+    Local<panda::StringRef> key = panda::StringRef::GetNapiWrapperString(vm);
+    for (size_t i = 0; i < count; ++i) {
+        Local<panda::ObjectRef> object(objects[i]);
+        results[i] = GetWrappedData(vm, object, key);
+    }
     return GET_RETURN_STATUS(env);
 }
 
@@ -2348,6 +2657,19 @@ NAPI_EXTERN napi_status napi_remove_wrap(napi_env env, napi_value js_object, voi
     auto vm = engine->GetEcmaVm();
     panda::JsiFastNativeScope fastNativeScope(vm);
     CHECK_AND_CONVERT_TO_OBJECT(env, vm, nativeValue, nativeObject);
+    if (UNLIKELY(g_directWrapUsed.load(std::memory_order_relaxed)) && IsWrappedInPlace(vm, nativeObject)) {
+        auto ref = reinterpret_cast<NativeReference*>(nativeObject->GetNativePointerField(vm, 0));
+        // the tag stays, so a later wrap of the object goes in place again
+        if (ref == nullptr) {
+            HILOG_ERROR("napi_remove_wrap: current js_object has been unwrapped.");
+            *result = nullptr;
+            return napi_set_last_error(env, napi_invalid_arg);
+        }
+        *result = ref->GetData();
+        nativeObject->SetNativePointerField(vm, 0, nullptr, nullptr, nullptr, 0);
+        delete ref;
+        return GET_RETURN_STATUS(env);
+    }
     Local<panda::StringRef> key = panda::StringRef::GetNapiWrapperString(vm);
     Local<panda::JSValueRef> val = nativeObject->Get(vm, key);
     *result = nullptr;
@@ -2549,7 +2871,7 @@ NAPI_EXTERN napi_status napi_create_reference(napi_env env,
     CHECK_ARG(env, value);
     CHECK_ARG(env, result);
     auto engine = reinterpret_cast<ArkNativeEngine*>(env);
-    auto ref = new ArkNativeReference(engine, value, initial_refcount);
+    auto ref = new (engine) ArkNativeReference(engine, value, initial_refcount);
 
     // Register global ref mapping for heap snapshot tracking
     if (!engine->IsInDestructor() && panda::JSNApi::IsTrackGlobalRefEnabled()) {
@@ -2566,17 +2888,9 @@ NAPI_EXTERN napi_status napi_create_reference(napi_env env,
     return napi_clear_last_error(env);
 }
 
-// Deletes a reference. The referenced value is released, and may
-// be GC'd unless there are other references to it.
-NAPI_EXTERN napi_status napi_delete_reference(napi_env env, napi_ref ref)
+static void DeleteReference(ArkNativeEngine* engine, NativeReference* reference)
 {
-    CHECK_ENV(env);
-    CHECK_ARG(env, ref);
-
-    auto reference = reinterpret_cast<NativeReference*>(ref);
-
     // Unregister global ref mapping before deletion
-    auto engine = reinterpret_cast<ArkNativeEngine*>(env);
     if (!engine->IsInDestructor() && panda::JSNApi::IsTrackGlobalRefEnabled()) {
         uintptr_t slotAddress = reference->GetGlobalRefSlotAddress();
         if (slotAddress != 0) {
@@ -2593,7 +2907,16 @@ NAPI_EXTERN napi_status napi_delete_reference(napi_env env, napi_ref ref)
     } else {
         reference->SetDeleteSelf();
     }
+}
+
+// Deletes a reference. The referenced value is released, and may
+// be GC'd unless there are other references to it.
+NAPI_EXTERN napi_status napi_delete_reference(napi_env env, napi_ref ref)
+{
+    CHECK_ENV(env);
+    CHECK_ARG(env, ref);
 
+    DeleteReference(reinterpret_cast<ArkNativeEngine*>(env), reinterpret_cast<NativeReference*>(ref));
     return napi_clear_last_error(env);
 }
 
@@ -2652,6 +2975,133 @@ NAPI_EXTERN napi_status napi_get_reference_value(napi_env env, napi_ref ref, nap
     return napi_clear_last_error(env);
 }
 
+NAPI_EXTERN napi_status napi_get_reference_values(napi_env env,
+                                                  const napi_ref* refs,
+                                                  size_t count,
+                                                  napi_value* results,
+                                                  size_t* dead_count)
+{
+    CHECK_ENV(env);
+    CHECK_ARG(env, refs);
+    CHECK_ARG(env, results);
+
+    NativeEngine* engine = reinterpret_cast<NativeEngine*>(env);
+    size_t dead = 0;
+    for (size_t i = 0; i < count; ++i) {
+        RETURN_STATUS_IF_FALSE(env, refs[i] != nullptr, napi_invalid_arg);
+        results[i] = reinterpret_cast<NativeReference*>(refs[i])->Get(engine);
+        if (results[i] == nullptr) {
+            dead++;
+        }
+    }
+    if (dead_count != nullptr) {
+        *dead_count = dead;
+    }
+    return napi_clear_last_error(env);
+}
+
+NAPI_EXTERN napi_status napi_create_reference_group(napi_env env, napi_reference_group* result)
+{
+    CHECK_ENV(env);
+    CHECK_ARG(env, result);
+
+    auto group = new NativeReferenceGroup(reinterpret_cast<NativeEngine*>(env));
+    *result = reinterpret_cast<napi_reference_group>(group);
+    return napi_clear_last_error(env);
+}
+
+NAPI_EXTERN napi_status napi_delete_reference_group(napi_env env, napi_reference_group group)
+{
+    CHECK_ENV(env);
+    CHECK_ARG(env, group);
+
+    auto engine = reinterpret_cast<ArkNativeEngine*>(env);
+    auto referenceGroup = reinterpret_cast<NativeReferenceGroup*>(group);
+    RETURN_STATUS_IF_FALSE(env, referenceGroup->GetEngine() == engine, napi_invalid_arg);
+    for (auto reference : referenceGroup->GetReferences()) {
+        DeleteReference(engine, reference);
+    }
+    delete referenceGroup;
+    return napi_clear_last_error(env);
+}
+
+NAPI_EXTERN napi_status napi_reference_group_add(napi_env env,
+                                                 napi_reference_group group,
+                                                 napi_value value,
+                                                 uint32_t initial_refcount)
+{
+    CHECK_ENV(env);
+    CHECK_ARG(env, group);
+    CHECK_ARG(env, value);
+
+    auto engine = reinterpret_cast<ArkNativeEngine*>(env);
+    auto referenceGroup = reinterpret_cast<NativeReferenceGroup*>(group);
+    RETURN_STATUS_IF_FALSE(env, referenceGroup->GetEngine() == engine, napi_invalid_arg);
+    napi_ref ref = nullptr;
+    napi_status status = napi_create_reference(env, value, initial_refcount, &ref);
+    if (status != napi_ok) {
+        return status;
+    }
+    referenceGroup->GetReferences().push_back(reinterpret_cast<NativeReference*>(ref));
+    return napi_clear_last_error(env);
+}
+
+NAPI_EXTERN napi_status napi_reference_group_remove(napi_env env, napi_reference_group group, napi_value value)
+{
+    CHECK_ENV(env);
+    CHECK_ARG(env, group);
+    CHECK_ARG(env, value);
+
+    auto engine = reinterpret_cast<ArkNativeEngine*>(env);
+    auto referenceGroup = reinterpret_cast<NativeReferenceGroup*>(group);
+    RETURN_STATUS_IF_FALSE(env, referenceGroup->GetEngine() == engine, napi_invalid_arg);
+    auto vm = engine->GetEcmaVm();
+    auto target = LocalValueFromJsValue(value);
+    auto& references = referenceGroup->GetReferences();
+    for (auto it = references.begin(); it != references.end(); ++it) {
+        napi_value member = (*it)->Get(engine);
+        if (member != nullptr && LocalValueFromJsValue(member)->IsStrictEquals(vm, target)) {
+            DeleteReference(engine, *it);
+            references.erase(it);
+            return napi_clear_last_error(env);
+        }
+    }
+    return napi_set_last_error(env, napi_invalid_arg);
+}
+
+NAPI_EXTERN napi_status napi_reference_group_get_values(napi_env env,
+                                                        napi_reference_group group,
+                                                        napi_value* results,
+                                                        size_t capacity,
+                                                        size_t* count)
+{
+    CHECK_ENV(env);
+    CHECK_ARG(env, group);
+    CHECK_ARG(env, count);
+
+    auto engine = reinterpret_cast<ArkNativeEngine*>(env);
+    auto referenceGroup = reinterpret_cast<NativeReferenceGroup*>(group);
+    RETURN_STATUS_IF_FALSE(env, referenceGroup->GetEngine() == engine, napi_invalid_arg);
+    RETURN_STATUS_IF_FALSE(env, results != nullptr || capacity == 0, napi_invalid_arg);
+    // one pass resolves the members and drops the dead ones in place, the live ones keep their order
+    auto& references = referenceGroup->GetReferences();
+    size_t live = 0;
+    for (auto reference : references) {
+        napi_value member = reference->Get(engine);
+        if (member == nullptr) {
+            DeleteReference(engine, reference);
+            continue;
+        }
+        if (live < capacity) {
+            results[live] = member;
+        }
+        references[live++] = reference;
+    }
+    references.resize(live);
+    *count = live;
+    return napi_clear_last_error(env);
+}
+
 NAPI_EXTERN napi_status napi_set_store_global_ref(napi_env env, bool enable)
 {
     NAPI_PREAMBLE(env);
@@ -3523,15 +3973,51 @@ NAPI_EXTERN napi_status napi_load_module_with_info(napi_env env,
 }
 
 // Memory management
+// context envs share the vm of their root engine, which owns the async channel and flushes the accumulator
+static inline NativeEngine* GetExternalMemoryEngine(napi_env env)
+{
+    auto engine = reinterpret_cast<NativeEngine*>(env);
+    if (!engine->IsMainEnvContext()) {
+        engine = const_cast<NativeEngine*>(engine->GetParent());
+    }
+    return engine;
+}
+
 NAPI_INNER_EXTERN napi_status napi_adjust_external_memory(
     napi_env env, int64_t change_in_bytes, int64_t* adjusted_value)
 {
     CHECK_ENV(env);
     CHECK_ARG(env, adjusted_value);
 
-    auto engine = reinterpret_cast<NativeEngine*>(env);
-    engine->AdjustExternalMemory(change_in_bytes, adjusted_value);
+    auto engine = GetExternalMemoryEngine(env);
+    // batched with the reports of other threads, the vm gets the change at the next flush
+    engine->ReportExternalMemory(change_in_bytes);
+    *adjusted_value = engine->GetExternalMemory().GetTotal();
+
+    return napi_clear_last_error(env);
+}
+
+NAPI_EXTERN napi_status napi_report_external_memory(napi_env env, int64_t change_in_bytes)
+{
+    // any thread, so the last error of env is left alone
+    CHECK_ENV(env);
+
+    GetExternalMemoryEngine(env)->ReportExternalMemory(change_in_bytes);
+    return napi_ok;
+}
+
+NAPI_EXTERN napi_status napi_set_external_memory_flush_threshold(napi_env env, int64_t threshold_in_bytes)
+{
+    CHECK_ENV(env);
+    RETURN_STATUS_IF_FALSE(env, threshold_in_bytes > 0, napi_invalid_arg);
 
+    auto engine = GetExternalMemoryEngine(env);
+    engine->GetExternalMemory().SetThreshold(threshold_in_bytes);
+    // a pending change already past the new threshold does not wait for the next report
+    int64_t pending = engine->GetExternalMemory().GetPending();
+    if (pending >= threshold_in_bytes || pending <= -threshold_in_bytes) {
+        engine->FlushExternalMemory();
+    }
     return napi_clear_last_error(env);
 }
 
@@ -4086,6 +4572,8 @@ NAPI_EXTERN napi_status napi_detach_arraybuffer(napi_env env, napi_value arraybu
     return napi_clear_last_error(env);
 }
 
+static constexpr char TYPE_TAG_KEY[] = "ACENAPI_TYPETAG";
+
 NAPI_EXTERN napi_status napi_type_tag_object(napi_env env, napi_value js_object, const napi_type_tag* type_tag)
 {
     NAPI_PREAMBLE(env);
@@ -4099,12 +4587,26 @@ NAPI_EXTERN napi_status napi_type_tag_object(napi_env env, napi_value js_object,
     RETURN_STATUS_IF_FALSE(env, nativeValue->IsObjectWithoutSwitchState(vm), napi_object_expected);
     auto obj = nativeValue->ToEcmaObject(vm);
     NapiTypeTag* typeTag = (NapiTypeTag*)type_tag;
-    const char name[] = "ACENAPI_TYPETAG";
+    // a tag set before stays, whether it is in place or a property
+    bool inPlace = g_directWrapUsed.load(std::memory_order_relaxed) && IsWrappedInPlace(vm, obj);
+    if (inPlace && obj->GetNativePointerField(vm, DIRECT_WRAP_TYPE_TAG_FIELD) != nullptr) {
+        return napi_clear_last_error(env);
+    }
     bool hasPribate = false;
     bool result = true;
-    Local<panda::StringRef> key = StringRef::NewFromUtf8(vm, name);
+    Local<panda::StringRef> key = StringRef::NewFromUtf8(vm, TYPE_TAG_KEY);
     hasPribate = obj->Has(vm, key);
     if (!hasPribate) {
+        // the tag goes next to an in place wrap, the object gets the in place fields when its env wraps in place
+        if (!inPlace && CanWrapInPlace(engine, vm, obj, panda::StringRef::GetNapiWrapperString(vm))) {
+            PrepareInPlace(vm, obj);
+            inPlace = true;
+        }
+        if (inPlace) {
+            obj->SetNativePointerField(vm, DIRECT_WRAP_TYPE_TAG_FIELD, const_cast<NapiTypeTag*>(InternTypeTag(typeTag)),
+                                       nullptr, nullptr, 0);
+            return napi_clear_last_error(env);
+        }
         uint32_t size = 2; // 2 : size for type tag
         Local<panda::JSValueRef> value = panda::BigIntRef::CreateBigWords(vm, false, size,
                                                                           reinterpret_cast<const uint64_t*>(typeTag));
@@ -4145,6 +4647,33 @@ bool BigIntGetWordsArray(const EcmaVM* vm, Local<panda::BigIntRef> &value, int*
     return false;
 }
 
+// an in place tag is a pointer load and a compare, objects without one fall back to the tag property
+static bool HasTypeTag(const EcmaVM* vm, const Local<panda::ObjectRef>& obj, const NapiTypeTag* typeTag, bool inPlace)
+{
+    if (inPlace) {
+        auto tag = reinterpret_cast<const NapiTypeTag*>(obj->GetNativePointerField(vm, DIRECT_WRAP_TYPE_TAG_FIELD));
+        if (tag != nullptr) {
+            return tag->lower == typeTag->lower && tag->upper == typeTag->upper;
+        }
+    }
+    Local<panda::StringRef> key = panda::StringRef::NewFromUtf8(vm, TYPE_TAG_KEY);
+    bool result = obj->Has(vm, key);
+    if (result) {
+        Local<panda::JSValueRef> object = obj->Get(vm, key);
+        if (object->IsBigInt(vm)) {
+            int sign;
+            size_t size = 2; // 2: Indicates that the number of elements is 2
+            NapiTypeTag tag;
+            Local<panda::BigIntRef> bigintObj = object->ToBigInt(vm);
+            BigIntGetWordsArray(vm, bigintObj, &sign, &size, reinterpret_cast<uint64_t*>(&tag));
+            if (sign == 0 && ((size == 1) || (size == 2))) { // 2: Indicates that the number of elements is 2
+                result = (tag.lower == typeTag->lower && tag.upper == typeTag->upper);
+            }
+        }
+    }
+    return result;
+}
+
 NAPI_EXTERN napi_status napi_check_object_type_tag(napi_env env,
                                                    napi_value js_object,
                                                    const napi_type_tag* type_tag,
@@ -4161,26 +4690,38 @@ NAPI_EXTERN napi_status napi_check_object_type_tag(napi_env env,
     panda::JsiFastNativeScope fastNativeScope(vm);
     RETURN_STATUS_IF_FALSE(env, nativeValue->IsObjectWithoutSwitchState(vm), napi_object_expected);
     auto obj = nativeValue->ToEcmaObject(vm);
-    NapiTypeTag* typeTag = (NapiTypeTag*)type_tag;
-    *result = false;
-    const char name[] = "ACENAPI_TYPETAG";
+    bool inPlace = g_directWrapUsed.load(std::memory_order_relaxed) && IsWrappedInPlace(vm, obj);
+    *result = HasTypeTag(vm, obj, reinterpret_cast<const NapiTypeTag*>(type_tag), inPlace);
+    return napi_clear_last_error(env);
+}
 
-    Local<panda::StringRef> key = panda::StringRef::NewFromUtf8(vm, name);
-    *result = obj->Has(vm, key);
-    if (*result) {
-        Local<panda::JSValueRef> object = obj->Get(vm, key);
-        if (object->IsBigInt(vm)) {
-            int sign;
-            size_t size = 2; // 2: Indicates that the number of elements is 2
-            NapiTypeTag tag;
-            Local<panda::BigIntRef> bigintObj = object->ToBigInt(vm);
-            BigIntGetWordsArray(vm, bigintObj, &sign, &size, reinterpret_cast<uint64_t*>(&tag));
-            if (sign == 0 && ((size == 1) || (size == 2))) { // 2: Indicates that the number of elements is 2
-                *result = (tag.lower == typeTag->lower && tag.upper == typeTag->upper);
-            }
-        }
+NAPI_EXTERN napi_status napi_unwrap_with_type_tag(napi_env env,
+                                                  napi_value js_object,
+                                                  const napi_type_tag* type_tag,
+                                                  void** result)
+{
+    NAPI_PREAMBLE(env);
+    CHECK_ARG(env, js_object);
+    CHECK_ARG(env, type_tag);
+    CHECK_ARG(env, result);
+
+    auto nativeValue = LocalValueFromJsValue(js_object);
+    SWITCH_CONTEXT_HOTPOT_OPT(env);
+    auto vm = reinterpret_cast<NativeEngine*>(env)->GetEcmaVm();
+    panda::JsiFastNativeScope fastNativeScope(vm);
+    CHECK_AND_CONVERT_TO_OBJECT_HOTPOT_OPT(env, vm, nativeValue, nativeObject);
+    *result = nullptr;
+    auto typeTag = reinterpret_cast<const NapiTypeTag*>(type_tag);
+    // tag and wrap of an object wrapped in place are read from the same fields, with no property lookup
+    if (UNLIKELY(g_directWrapUsed.load(std::memory_order_relaxed)) && IsWrappedInPlace(vm, nativeObject)) {
+        RETURN_STATUS_IF_FALSE(env, HasTypeTag(vm, nativeObject, typeTag, true), napi_invalid_arg);
+        auto ref = reinterpret_cast<NativeReference*>(nativeObject->GetNativePointerField(vm, 0));
+        *result = ref != nullptr ? ref->GetData() : nullptr;
+        return GET_RETURN_STATUS(env);
     }
-    return napi_clear_last_error(env);
+    RETURN_STATUS_IF_FALSE(env, HasTypeTag(vm, nativeObject, typeTag, false), napi_invalid_arg);
+    *result = GetWrappedData(vm, nativeObject, panda::StringRef::GetNapiWrapperString(vm));
+    return GET_RETURN_STATUS(env);
 }
 
 NAPI_EXTERN napi_status napi_create_date(napi_env env, double time, napi_value* result)
@@ -4245,6 +4786,33 @@ NAPI_EXTERN napi_status napi_add_finalizer(napi_env env,
     return napi_clear_last_error(env);
 }
 
+NAPI_EXTERN napi_status napi_add_async_finalizer(napi_env env,
+                                                 napi_value js_object,
+                                                 void* native_object,
+                                                 napi_finalize finalize_cb,
+                                                 void* finalize_hint,
+                                                 napi_ref* result)
+{
+    CHECK_ENV(env);
+    CHECK_ARG(env, js_object);
+    CHECK_ARG(env, finalize_cb);
+
+    auto nativeValue = LocalValueFromJsValue(js_object);
+    auto callback = reinterpret_cast<NapiNativeFinalize>(finalize_cb);
+    auto vm = reinterpret_cast<NativeEngine*>(env)->GetEcmaVm();
+    panda::JsiFastNativeScope fastNativeScope(vm);
+
+    RETURN_STATUS_IF_FALSE(env, nativeValue->IsObjectWithoutSwitchState(vm), napi_object_expected);
+    auto engine = reinterpret_cast<NativeEngine*>(env);
+    if (result != nullptr) {
+        auto reference = engine->CreateAsyncReference(js_object, 1, false, callback, native_object, finalize_hint);
+        *result = reinterpret_cast<napi_ref>(reference);
+    } else {
+        engine->CreateAsyncReference(js_object, 0, true, callback, native_object, finalize_hint);
+    }
+    return napi_clear_last_error(env);
+}
+
 NAPI_EXTERN napi_status napi_create_bigint_words(napi_env env,
                                                  int sign_bit,
                                                  size_t word_count,
@@ -4969,7 +5537,7 @@ NAPI_EXTERN napi_status napi_create_strong_sendable_reference(napi_env env,
         return napi_set_last_error(env, napi_object_expected);
     }
 
-    auto ref = new ArkSendableNativeReference(engine, nativeValue);
+    auto ref = new (engine) ArkSendableNativeReference(engine, nativeValue);
 
     *result = reinterpret_cast<napi_sendable_ref>(ref);
     return napi_clear_last_error(env);
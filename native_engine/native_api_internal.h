@@ -149,6 +149,9 @@ inline bool ValidEngineCheck(NativeEngine* input,
 #define VALID_ENGINE_CHECK(input, owner, id) \
     ValidEngineCheck((input), (owner), (id), __FUNCTION__, __FILENAME__, __LINE__)
 
+// true when object keeps its napi_wrap reference in its own native pointer fields instead of a wrapper object
+bool IsObjectWrappedInPlace(const EcmaVM* vm, const panda::Local<panda::ObjectRef>& object);
+
 #ifdef ENABLE_CONTAINER_SCOPE
 inline bool EnableContainerScope(napi_env env)
 {
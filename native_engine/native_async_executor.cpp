@@ -0,0 +1,490 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "native_async_executor.h"
+
+#include <algorithm>
+#ifdef LINUX_PLATFORM
+#include <pthread.h>
+#endif
+
+#include "utils/log.h"
+
+namespace {
+struct WorkerIdentity {
+    const NativeWorkStealingExecutor* executor = nullptr;
+    size_t index = 0;
+};
+thread_local WorkerIdentity g_currentWorker;
+} // namespace
+
+NativeWorkStealingDeque::NativeWorkStealingDeque()
+{
+    arrays_.emplace_back(std::make_unique<Array>(INITIAL_CAPACITY));
+    array_.store(arrays_.back().get(), std::memory_order_relaxed);
+}
+
+NativeWorkStealingDeque::Array* NativeWorkStealingDeque::Grow(Array* array, int64_t top, int64_t bottom)
+{
+    arrays_.emplace_back(std::make_unique<Array>((array->mask + 1) * 2));
+    Array* grown = arrays_.back().get();
+    for (int64_t i = top; i < bottom; ++i) {
+        grown->Put(i, array->Get(i));
+    }
+    array_.store(grown, std::memory_order_release);
+    return grown;
+}
+
+void NativeWorkStealingDeque::Push(NativeAsyncTask task)
+{
+    int64_t bottom = bottom_.load(std::memory_order_relaxed);
+    int64_t top = top_.load(std::memory_order_acquire);
+    Array* array = array_.load(std::memory_order_relaxed);
+    if (bottom - top > static_cast<int64_t>(array->mask)) {
+        array = Grow(array, top, bottom);
+    }
+    array->Put(bottom, task);
+    std::atomic_thread_fence(std::memory_order_release);
+    bottom_.store(bottom + 1, std::memory_order_relaxed);
+}
+
+bool NativeWorkStealingDeque::Pop(NativeAsyncTask& task)
+{
+    int64_t bottom = bottom_.load(std::memory_order_relaxed) - 1;
+    Array* array = array_.load(std::memory_order_relaxed);
+    bottom_.store(bottom, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t top = top_.load(std::memory_order_relaxed);
+    if (top > bottom) {
+        bottom_.store(bottom + 1, std::memory_order_relaxed);
+        return false;
+    }
+    task = array->Get(bottom);
+    if (top == bottom) {
+        // the last task, the owner races the thieves for it
+        bool won = top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+        bottom_.store(bottom + 1, std::memory_order_relaxed);
+        return won;
+    }
+    return true;
+}
+
+bool NativeWorkStealingDeque::Steal(NativeAsyncTask& task)
+{
+    int64_t top = top_.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t bottom = bottom_.load(std::memory_order_acquire);
+    if (top >= bottom) {
+        return false;
+    }
+    Array* array = array_.load(std::memory_order_acquire);
+    NativeAsyncTask stolen = array->Get(top);
+    if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+        return false;
+    }
+    task = stolen;
+    return true;
+}
+
+NativeAsyncInjectionRing::NativeAsyncInjectionRing(size_t capacity)
+{
+    size_t realCapacity = 1;
+    while (realCapacity < capacity) {
+        realCapacity <<= 1;
+    }
+    mask_ = realCapacity - 1;
+    cells_ = std::make_unique<Cell[]>(realCapacity);
+    for (size_t i = 0; i < realCapacity; ++i) {
+        cells_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+bool NativeAsyncInjectionRing::TryPush(NativeAsyncTask task)
+{
+    size_t pos = enqueuePos_.load(std::memory_order_relaxed);
+    Cell* cell = nullptr;
+    for (;;) {
+        cell = &cells_[pos & mask_];
+        size_t seq = cell->sequence.load(std::memory_order_acquire);
+        intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+        if (diff == 0) {
+            if (enqueuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            return false;
+        } else {
+            pos = enqueuePos_.load(std::memory_order_relaxed);
+        }
+    }
+    cell->task = task;
+    cell->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+}
+
+bool NativeAsyncInjectionRing::TryPop(NativeAsyncTask& task)
+{
+    size_t pos = dequeuePos_.load(std::memory_order_relaxed);
+    Cell* cell = nullptr;
+    for (;;) {
+        cell = &cells_[pos & mask_];
+        size_t seq = cell->sequence.load(std::memory_order_acquire);
+        intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+        if (diff == 0) {
+            if (dequeuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            return false;
+        } else {
+            pos = dequeuePos_.load(std::memory_order_relaxed);
+        }
+    }
+    task = cell->task;
+    cell->sequence.store(pos + mask_ + 1, std::memory_order_release);
+    return true;
+}
+
+NativeWorkStealingExecutor::NativeWorkStealingExecutor(size_t workerCount)
+{
+    size_t count = std::max<size_t>(1, workerCount);
+    // lanes follow napi_qos_t, background and utility leave workers free for the interactive lanes
+    laneLimits_[LaneOf(napi_qos_background)] = std::max<size_t>(1, count / 2);
+    laneLimits_[LaneOf(napi_qos_utility)] = std::max<size_t>(1, count - 1);
+    laneLimits_[LaneOf(napi_qos_default)] = count;
+    laneLimits_[LaneOf(napi_qos_user_initiated)] = count;
+    for (auto& ring : injection_) {
+        ring = std::make_unique<NativeAsyncInjectionRing>(INJECTION_CAPACITY);
+    }
+    workers_.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        workers_.emplace_back(std::make_unique<Worker>());
+    }
+    for (size_t i = 0; i < count; ++i) {
+        workers_[i]->thread = std::thread(&NativeWorkStealingExecutor::WorkerLoop, this, i);
+    }
+}
+
+NativeWorkStealingExecutor::~NativeWorkStealingExecutor()
+{
+    stopping_.store(true, std::memory_order_seq_cst);
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex_);
+        epoch_.fetch_add(1, std::memory_order_relaxed);
+    }
+    sleepCv_.notify_all();
+    for (auto& worker : workers_) {
+        if (worker->thread.joinable()) {
+            worker->thread.join();
+        }
+    }
+}
+
+NativeWorkStealingExecutor* NativeWorkStealingExecutor::GetInstance()
+{
+    static NativeWorkStealingExecutor* instance = new NativeWorkStealingExecutor(std::thread::hardware_concurrency());
+    return instance;
+}
+
+size_t NativeWorkStealingExecutor::LaneOf(napi_qos_t qos)
+{
+    switch (qos) {
+        case napi_qos_background:
+        case napi_qos_utility:
+        case napi_qos_default:
+        case napi_qos_user_initiated:
+            return static_cast<size_t>(qos);
+        default:
+            return static_cast<size_t>(napi_qos_default);
+    }
+}
+
+size_t NativeWorkStealingExecutor::GetLaneLimit(napi_qos_t qos) const
+{
+    return laneLimits_[LaneOf(qos)];
+}
+
+bool NativeWorkStealingExecutor::Submit(napi_qos_t qos, NativeAsyncTask task)
+{
+    if (task.run == nullptr) {
+        return false;
+    }
+    if (stopping_.load(std::memory_order_acquire)) {
+        HILOG_ERROR("executor is stopping");
+        return false;
+    }
+    size_t lane = LaneOf(qos);
+    laneQueued_[lane].fetch_add(1, std::memory_order_seq_cst);
+    if (g_currentWorker.executor == this) {
+        workers_[g_currentWorker.index]->lanes[lane].Push(task);
+    } else if (overflowSize_.load(std::memory_order_acquire) != 0 || !injection_[lane]->TryPush(task)) {
+        std::lock_guard<std::mutex> lock(overflowMutex_);
+        overflow_[lane].push_back(task);
+        overflowSize_.fetch_add(1, std::memory_order_release);
+    }
+    Wake();
+    return true;
+}
+
+void NativeWorkStealingExecutor::Wake()
+{
+    // pairs with the sleeper count bumped before a worker checks for tasks the last time
+    if (sleepers_.load(std::memory_order_seq_cst) == 0) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex_);
+        epoch_.fetch_add(1, std::memory_order_relaxed);
+    }
+    sleepCv_.notify_one();
+}
+
+bool NativeWorkStealingExecutor::TakeFromLane(size_t index, size_t lane, NativeAsyncTask& task)
+{
+    if (workers_[index]->lanes[lane].Pop(task) || injection_[lane]->TryPop(task)) {
+        return true;
+    }
+    if (overflowSize_.load(std::memory_order_acquire) != 0) {
+        std::lock_guard<std::mutex> lock(overflowMutex_);
+        auto& overflow = overflow_[lane];
+        if (!overflow.empty()) {
+            task = overflow.front();
+            overflow.pop_front();
+            overflowSize_.fetch_sub(1, std::memory_order_release);
+            return true;
+        }
+    }
+    size_t count = workers_.size();
+    for (size_t offset = 1; offset < count; ++offset) {
+        if (workers_[(index + offset) % count]->lanes[lane].Steal(task)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool NativeWorkStealingExecutor::TakeTask(size_t index, NativeAsyncTask& task, size_t& lane)
+{
+    for (size_t i = LANE_COUNT; i > 0; --i) {
+        lane = i - 1;
+        if (laneQueued_[lane].load(std::memory_order_acquire) == 0) {
+            continue;
+        }
+        size_t running = laneRunning_[lane].load(std::memory_order_relaxed);
+        do {
+            if (running >= laneLimits_[lane]) {
+                break;
+            }
+        } while (!laneRunning_[lane].compare_exchange_weak(running, running + 1, std::memory_order_acq_rel));
+        if (running >= laneLimits_[lane]) {
+            continue;
+        }
+        if (TakeFromLane(index, lane, task)) {
+            laneQueued_[lane].fetch_sub(1, std::memory_order_seq_cst);
+            return true;
+        }
+        laneRunning_[lane].fetch_sub(1, std::memory_order_seq_cst);
+    }
+    return false;
+}
+
+bool NativeWorkStealingExecutor::HasRunnableTask() const
+{
+    for (size_t lane = 0; lane < LANE_COUNT; ++lane) {
+        if (laneQueued_[lane].load(std::memory_order_seq_cst) != 0 &&
+            laneRunning_[lane].load(std::memory_order_seq_cst) < laneLimits_[lane]) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void NativeWorkStealingExecutor::WorkerLoop(size_t index)
+{
+    g_currentWorker.executor = this;
+    g_currentWorker.index = index;
+#ifdef LINUX_PLATFORM
+    pthread_setname_np(pthread_self(), "OS_NapiExecutor");
+#endif
+    for (;;) {
+        uint64_t epoch = epoch_.load(std::memory_order_acquire);
+        NativeAsyncTask task;
+        size_t lane = 0;
+        if (TakeTask(index, task, lane)) {
+            task.run(task.data);
+            laneRunning_[lane].fetch_sub(1, std::memory_order_seq_cst);
+            if (laneLimits_[lane] < workers_.size() && laneQueued_[lane].load(std::memory_order_seq_cst) > 0) {
+                // a task held back by the lane limit can run now
+                Wake();
+            }
+            continue;
+        }
+        // queued tasks are still run when stopping
+        if (stopping_.load(std::memory_order_acquire)) {
+            break;
+        }
+        // a task counted after this check sees the sleeper and wakes it
+        sleepers_.fetch_add(1, std::memory_order_seq_cst);
+        if (!HasRunnableTask()) {
+            std::unique_lock<std::mutex> lock(sleepMutex_);
+            sleepCv_.wait(lock, [this, epoch] {
+                return epoch_.load(std::memory_order_relaxed) != epoch || stopping_.load(std::memory_order_relaxed);
+            });
+        }
+        sleepers_.fetch_sub(1, std::memory_order_seq_cst);
+    }
+}
+
+bool NativeSerialQueues::Submit(uintptr_t queueId, napi_qos_t qos, NativeAsyncTask task)
+{
+    if (task.run == nullptr) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& queue = queues_[queueId];
+    if (queue != nullptr) {
+        queue->qos = std::max(queue->qos, qos);
+        queue->tasks.push_back(task);
+        return true;
+    }
+    queue = std::make_unique<Queue>();
+    queue->owner = this;
+    queue->id = queueId;
+    queue->qos = qos;
+    queue->tasks.push_back(task);
+    // submitted under the lock so a failure can not drop tasks other producers already appended
+    if (!executor_.Submit(qos, { Drain, queue.get() })) {
+        queues_.erase(queueId);
+        return false;
+    }
+    return true;
+}
+
+void NativeSerialQueues::Drain(void* data)
+{
+    auto queue = reinterpret_cast<Queue*>(data);
+    auto owner = queue->owner;
+    for (size_t ran = 0;; ++ran) {
+        NativeAsyncTask task;
+        {
+            std::lock_guard<std::mutex> lock(owner->mutex_);
+            if (queue->tasks.empty()) {
+                // idle queues are dropped, queue is freed here
+                owner->queues_.erase(queue->id);
+                return;
+            }
+            // when the executor does not take the queue back, keep draining it on this worker
+            if (ran >= DRAIN_BATCH && owner->executor_.Submit(queue->qos, { Drain, queue })) {
+                return;
+            }
+            task = queue->tasks.front();
+            queue->tasks.pop_front();
+        }
+        task.run(task.data);
+    }
+}
+
+bool NativeAsyncCompletionChannel::Init(uv_loop_t* loop)
+{
+    if (loop == nullptr || handle_ != nullptr) {
+        return false;
+    }
+    auto handle = new uv_async_t;
+    if (uv_async_init(loop, handle, OnAsync) != 0) {
+        HILOG_ERROR("failed to init the async completion channel");
+        delete handle;
+        return false;
+    }
+    handle->data = this;
+    uv_unref(reinterpret_cast<uv_handle_t*>(handle));
+    std::lock_guard<std::mutex> lock(mutex_);
+    handle_ = handle;
+    holders_ = 0;
+    return true;
+}
+
+void NativeAsyncCompletionChannel::Close()
+{
+    uv_async_t* handle = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        handle = handle_;
+        handle_ = nullptr;
+    }
+    if (handle == nullptr) {
+        return;
+    }
+    // completions posted before the handle was taken away still run, Post fails from here on
+    Drain();
+    if (holders_ != 0) {
+        HILOG_WARN("async completion channel closed with %{public}zu tasks in flight", holders_);
+    }
+    uv_close(reinterpret_cast<uv_handle_t*>(handle), [](uv_handle_t* handle) {
+        delete reinterpret_cast<uv_async_t*>(handle);
+    });
+}
+
+void NativeAsyncCompletionChannel::Hold()
+{
+    if (handle_ != nullptr && holders_++ == 0) {
+        uv_ref(reinterpret_cast<uv_handle_t*>(handle_));
+    }
+}
+
+void NativeAsyncCompletionChannel::Unhold()
+{
+    if (holders_ == 0) {
+        return;
+    }
+    if (--holders_ == 0 && handle_ != nullptr) {
+        uv_unref(reinterpret_cast<uv_handle_t*>(handle_));
+    }
+}
+
+bool NativeAsyncCompletionChannel::Post(Callback callback, void* data)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (handle_ == nullptr) {
+        HILOG_ERROR("async completion channel is closed");
+        return false;
+    }
+    bool wasEmpty = pending_.empty();
+    pending_.emplace_back(callback, data);
+    // a non-empty pending list already has a wakeup on the way
+    if (wasEmpty) {
+        uv_async_send(handle_);
+    }
+    return true;
+}
+
+void NativeAsyncCompletionChannel::OnAsync(uv_async_t* handle)
+{
+    auto that = reinterpret_cast<NativeAsyncCompletionChannel*>(handle->data);
+    if (that != nullptr) {
+        that->Drain();
+    }
+}
+
+void NativeAsyncCompletionChannel::Drain()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        draining_.swap(pending_);
+    }
+    for (auto& [callback, data] : draining_) {
+        callback(data);
+    }
+    draining_.clear();
+}
@@ -0,0 +1,306 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_NAPI_NATIVE_ENGINE_NATIVE_ASYNC_EXECUTOR_H
+#define FOUNDATION_ACE_NAPI_NATIVE_ENGINE_NATIVE_ASYNC_EXECUTOR_H
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <uv.h>
+#include <vector>
+
+#include "interfaces/kits/napi/common.h"
+
+struct NativeAsyncTask {
+    void (*run)(void* data) = nullptr;
+    void* data = nullptr;
+};
+
+class NativeAsyncExecutor;
+
+/*
+ * Serial queues multiplexed over an executor, keyed by the queue id of napi_queue_async_work_with_queue.
+ * The tasks of a queue run one at a time in submission order. A queue only exists while it has tasks, it is drained
+ * by a single executor task which yields the worker back every DRAIN_BATCH tasks so busy queues stay fair.
+ */
+class NativeSerialQueues {
+public:
+    static constexpr size_t DRAIN_BATCH = 16;
+
+    explicit NativeSerialQueues(NativeAsyncExecutor& executor) : executor_(executor) {}
+    ~NativeSerialQueues() = default;
+
+    NativeSerialQueues(const NativeSerialQueues&) = delete;
+    NativeSerialQueues& operator=(const NativeSerialQueues&) = delete;
+
+    bool Submit(uintptr_t queueId, napi_qos_t qos, NativeAsyncTask task);
+
+    size_t GetActiveCount() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return queues_.size();
+    }
+
+private:
+    struct Queue {
+        NativeSerialQueues* owner = nullptr;
+        uintptr_t id = 0;
+        // most urgent qos among the tasks queued since the queue became active
+        napi_qos_t qos = napi_qos_background;
+        std::deque<NativeAsyncTask> tasks;
+    };
+
+    static void Drain(void* data);
+
+    NativeAsyncExecutor& executor_;
+    mutable std::mutex mutex_;
+    std::unordered_map<uintptr_t, std::unique_ptr<Queue>> queues_;
+};
+
+/*
+ * Pluggable backend for the work pool side of async work, installed per engine with NativeEngine::SetAsyncExecutor.
+ * Without one, the works go to libuv as before.
+ */
+class NativeAsyncExecutor {
+public:
+    NativeAsyncExecutor() = default;
+    virtual ~NativeAsyncExecutor() = default;
+    // can be called by any thread, returns false when the task was not accepted, the task must not run inline
+    virtual bool Submit(napi_qos_t qos, NativeAsyncTask task) = 0;
+
+    // tasks with the same non-zero queue id run one after another in submission order
+    bool SubmitOrdered(napi_qos_t qos, uintptr_t queueId, NativeAsyncTask task)
+    {
+        return serialQueues_.Submit(queueId, qos, task);
+    }
+
+    size_t GetActiveSerialQueueCount() const
+    {
+        return serialQueues_.GetActiveCount();
+    }
+
+private:
+    NativeSerialQueues serialQueues_ { *this };
+};
+
+/*
+ * Chase-Lev deque of one executor worker. The owner pushes and pops at the bottom, other workers steal the oldest
+ * task from the top with a CAS, neither takes a lock. The array doubles when full, the replaced arrays are kept
+ * until the deque is destroyed since a thief may still read from them.
+ */
+class NativeWorkStealingDeque {
+public:
+    NativeWorkStealingDeque();
+    ~NativeWorkStealingDeque() = default;
+
+    NativeWorkStealingDeque(const NativeWorkStealingDeque&) = delete;
+    NativeWorkStealingDeque& operator=(const NativeWorkStealingDeque&) = delete;
+
+    // owner only
+    void Push(NativeAsyncTask task);
+    bool Pop(NativeAsyncTask& task);
+    // any thread, returns false when the deque is empty or another thread took the top task first
+    bool Steal(NativeAsyncTask& task);
+
+private:
+    static constexpr size_t INITIAL_CAPACITY = 64;
+    static constexpr size_t CACHE_LINE_SIZE = 64;
+
+    // a thief may read a cell the owner is overwriting, its CAS then fails and the torn task is dropped
+    struct Cell {
+        std::atomic<void (*)(void*)> run { nullptr };
+        std::atomic<void*> data { nullptr };
+    };
+
+    struct Array {
+        explicit Array(size_t capacity) : mask(capacity - 1), cells(std::make_unique<Cell[]>(capacity)) {}
+
+        void Put(int64_t index, NativeAsyncTask task)
+        {
+            Cell& cell = cells[static_cast<size_t>(index) & mask];
+            cell.run.store(task.run, std::memory_order_relaxed);
+            cell.data.store(task.data, std::memory_order_relaxed);
+        }
+
+        NativeAsyncTask Get(int64_t index) const
+        {
+            const Cell& cell = cells[static_cast<size_t>(index) & mask];
+            return { cell.run.load(std::memory_order_relaxed), cell.data.load(std::memory_order_relaxed) };
+        }
+
+        size_t mask;
+        std::unique_ptr<Cell[]> cells;
+    };
+
+    Array* Grow(Array* array, int64_t top, int64_t bottom);
+
+    alignas(CACHE_LINE_SIZE) std::atomic<int64_t> top_ { 0 };
+    alignas(CACHE_LINE_SIZE) std::atomic<int64_t> bottom_ { 0 };
+    std::atomic<Array*> array_ { nullptr };
+    // owner only, every array the deque used
+    std::vector<std::unique_ptr<Array>> arrays_;
+};
+
+/*
+ * Bounded lock-free multi-producer/multi-consumer ring for the tasks submitted from outside the workers.
+ * Every cell carries a sequence number, producers and consumers claim a cell with one CAS on their position.
+ */
+class NativeAsyncInjectionRing {
+public:
+    explicit NativeAsyncInjectionRing(size_t capacity);
+    ~NativeAsyncInjectionRing() = default;
+
+    NativeAsyncInjectionRing(const NativeAsyncInjectionRing&) = delete;
+    NativeAsyncInjectionRing& operator=(const NativeAsyncInjectionRing&) = delete;
+
+    // returns false when the ring is full
+    bool TryPush(NativeAsyncTask task);
+    // returns false when no published cell is available
+    bool TryPop(NativeAsyncTask& task);
+
+private:
+    static constexpr size_t CACHE_LINE_SIZE = 64;
+
+    struct Cell {
+        std::atomic<size_t> sequence { 0 };
+        NativeAsyncTask task;
+    };
+
+    std::unique_ptr<Cell[]> cells_;
+    size_t mask_ = 0;
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> enqueuePos_ { 0 };
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> dequeuePos_ { 0 };
+};
+
+/*
+ * Work stealing executor, one worker per core. Engines only use it once opted in with
+ * napi_set_work_stealing_executor_enabled.
+ * Every worker owns one NativeWorkStealingDeque per qos lane, tasks submitted by a worker go to its own deques and
+ * the others to a lock-free injection ring per lane, a mutex guarded overflow only takes what a full ring can not
+ * hold. A worker serves the highest lane first: its own deque, then the injection ring, then the top of the other
+ * workers' deques. Background and utility tasks may only occupy part of the workers at once, so a few long
+ * background tasks can not hold back user initiated work. Idle workers park on a condition variable, submitters only
+ * take its mutex when some worker is parked.
+ */
+class NativeWorkStealingExecutor : public NativeAsyncExecutor {
+public:
+    static constexpr size_t LANE_COUNT = 4;
+    static constexpr size_t INJECTION_CAPACITY = 1024;
+
+    explicit NativeWorkStealingExecutor(size_t workerCount);
+    ~NativeWorkStealingExecutor() override;
+
+    NativeWorkStealingExecutor(const NativeWorkStealingExecutor&) = delete;
+    NativeWorkStealingExecutor& operator=(const NativeWorkStealingExecutor&) = delete;
+
+    bool Submit(napi_qos_t qos, NativeAsyncTask task) override;
+
+    size_t GetWorkerCount() const
+    {
+        return workers_.size();
+    }
+
+    // max number of workers running tasks of the lane at the same time
+    size_t GetLaneLimit(napi_qos_t qos) const;
+
+    // process wide instance sized from the core count, it is never destroyed
+    static NativeWorkStealingExecutor* GetInstance();
+
+private:
+    struct Worker {
+        std::array<NativeWorkStealingDeque, LANE_COUNT> lanes;
+        std::thread thread;
+    };
+
+    static size_t LaneOf(napi_qos_t qos);
+    void WorkerLoop(size_t index);
+    bool TakeTask(size_t index, NativeAsyncTask& task, size_t& lane);
+    bool TakeFromLane(size_t index, size_t lane, NativeAsyncTask& task);
+    bool HasRunnableTask() const;
+    void Wake();
+
+    std::vector<std::unique_ptr<Worker>> workers_;
+    std::array<std::unique_ptr<NativeAsyncInjectionRing>, LANE_COUNT> injection_;
+    std::array<size_t, LANE_COUNT> laneLimits_ {};
+    std::array<std::atomic<size_t>, LANE_COUNT> laneRunning_ {};
+    // counted before a task is pushed, so a taker never sees fewer than the tasks which are visible
+    std::array<std::atomic<size_t>, LANE_COUNT> laneQueued_ {};
+    std::atomic<size_t> nextWorker_ { 0 };
+    std::mutex overflowMutex_;
+    std::array<std::deque<NativeAsyncTask>, LANE_COUNT> overflow_;
+    std::atomic<size_t> overflowSize_ { 0 };
+    std::atomic<size_t> sleepers_ { 0 };
+    std::mutex sleepMutex_;
+    std::condition_variable sleepCv_;
+    // bumped under sleepMutex_ to wake parked workers, read without it
+    std::atomic<uint64_t> epoch_ { 0 };
+    std::atomic<bool> stopping_ { false };
+};
+
+/*
+ * Brings the results of executor tasks back to the loop thread of an engine.
+ * Post can be called from any thread, the callbacks run on the loop thread in post order. The uv handle only keeps
+ * the loop alive while some task holds it. The owner runs the loop until nothing is held before Close, which runs
+ * the callbacks still pending, so no completion is lost; Post after Close returns false and the caller keeps its
+ * item. Nothing is submitted after Close, as IsOpen turns false.
+ */
+class NativeAsyncCompletionChannel {
+public:
+    using Callback = void (*)(void* data);
+
+    NativeAsyncCompletionChannel() = default;
+    ~NativeAsyncCompletionChannel() = default;
+
+    NativeAsyncCompletionChannel(const NativeAsyncCompletionChannel&) = delete;
+    NativeAsyncCompletionChannel& operator=(const NativeAsyncCompletionChannel&) = delete;
+
+    // loop thread only
+    bool Init(uv_loop_t* loop);
+    void Close();
+    bool IsOpen() const
+    {
+        return handle_ != nullptr;
+    }
+    // taken before submitting a task whose result will be posted, released once the result was handled
+    void Hold();
+    void Unhold();
+    bool IsHeld() const
+    {
+        return holders_ != 0;
+    }
+
+    bool Post(Callback callback, void* data);
+
+private:
+    static void OnAsync(uv_async_t* handle);
+    void Drain();
+
+    std::mutex mutex_;
+    uv_async_t* handle_ = nullptr;
+    std::vector<std::pair<Callback, void*>> pending_;
+    // loop thread only, kept across drains so the vector capacity is reused
+    std::vector<std::pair<Callback, void*>> draining_;
+    size_t holders_ = 0;
+};
+
+#endif /* FOUNDATION_ACE_NAPI_NATIVE_ENGINE_NATIVE_ASYNC_EXECUTOR_H */
@@ -44,8 +44,32 @@ NativeAsyncWork::NativeAsyncWork(NativeEngine* engine,
                                  void* data)
     : work_({ 0 }), engine_(engine), engineId_(engine->GetId()), execute_(execute), complete_(complete), data_(data)
 {
+    Init(engine, execute, complete, asyncResourceName.c_str(), data);
+}
+
+NativeAsyncWork::~NativeAsyncWork() = default;
+
+void NativeAsyncWork::Init(NativeEngine* engine,
+                           NativeAsyncExecuteCallback execute,
+                           NativeAsyncCompleteCallback complete,
+                           const char* asyncResourceName,
+                           void* data)
+{
+    work_ = uv_work_t { 0 };
     work_.data = this;
-    taskName_ = asyncResourceName;
+    engine_ = engine;
+    engineId_ = engine->GetId();
+    execute_ = execute;
+    complete_ = complete;
+    data_ = data;
+    executorState_.store(EXECUTOR_IDLE, std::memory_order_relaxed);
+    executorStatus_ = 0;
+    channel_.reset();
+    runState_.store(RUN_IDLE, std::memory_order_relaxed);
+    cancelledWhileRunning_ = false;
+    times_ = NativeTaskTimes();
+    // assign keeps the capacity of a reused object
+    taskName_.assign(asyncResourceName);
 #ifdef ENABLE_HITRACE
     if (!g_ParamUpdated.load()) {
         char napiTraceIdEnabled[TRACEID_PARAM_SIZE] = {0};
@@ -57,6 +81,7 @@ NativeAsyncWork::NativeAsyncWork(NativeEngine* engine,
         g_ParamUpdated.store(true);
     }
     bool createdTraceId = false;
+    taskTraceId_ = HiTraceId();
 
     HiTraceId thisId = HiTraceChain::GetId();
     if (g_napiTraceIdEnabled.load() && (!thisId.IsValid())) {
@@ -69,25 +94,24 @@ NativeAsyncWork::NativeAsyncWork(NativeEngine* engine,
     char traceStr[TRACE_BUFFER_SIZE] = {0};
     if (sprintf_s(traceStr, sizeof(traceStr),
         "name:%s#%" PRIuPTR ", traceid:0x%x",
-        asyncResourceName.c_str(),
+        asyncResourceName,
         reinterpret_cast<uintptr_t>(this),
         taskTraceId_.GetChainId()) < 0) {
         HILOG_ERROR("Get traceStr fail");
     }
-    traceDescription_ = traceStr;
+    traceDescription_.assign(traceStr);
     if (createdTraceId) {
         OHOS::HiviewDFX::HiTraceChain::ClearId();
     }
 #endif
 #ifdef ENABLE_CONTAINER_SCOPE
+    containerScopeId_ = 0;
     if (engine->IsContainerScopeEnabled()) {
         containerScopeId_ = engine->GetContainerScopeIdFunc();
     }
 #endif
 }
 
-NativeAsyncWork::~NativeAsyncWork() = default;
-
 bool NativeAsyncWork::Queue(NativeEngine* engine)
 {
     VALID_ENGINE_CHECK(engine, engine_, engineId_);
@@ -103,6 +127,11 @@ bool NativeAsyncWork::Queue(NativeEngine* engine)
         HILOG_ERROR("Get loop failed");
         return false;
     }
+    MarkQueued();
+    auto executor = GetExecutor();
+    if (executor != nullptr) {
+        return QueueToExecutor(executor, napi_qos_default);
+    }
     engine_->IncreaseWaitingRequestCounter();
 #ifdef ENABLE_HITRACE
     StartTrace(HITRACE_TAG_ACE, "Native async work queue, " + this->GetTraceDescription());
@@ -138,6 +167,11 @@ bool NativeAsyncWork::QueueWithQos(NativeEngine* engine, napi_qos_t qos)
         HILOG_ERROR("Get loop failed");
         return false;
     }
+    MarkQueued();
+    auto executor = GetExecutor();
+    if (executor != nullptr) {
+        return QueueToExecutor(executor, qos);
+    }
     engine_->IncreaseWaitingRequestCounter();
 #ifdef ENABLE_HITRACE
     StartTrace(HITRACE_TAG_ACE, "Native async work queueWithQos, " + this->GetTraceDescription());
@@ -174,6 +208,11 @@ bool NativeAsyncWork::QueueOrdered(NativeEngine* engine, napi_qos_t qos, uintptr
         HILOG_ERROR("Get loop failed");
         return false;
     }
+    MarkQueued();
+    auto executor = GetExecutor();
+    if (executor != nullptr) {
+        return QueueToExecutor(executor, qos, queueId);
+    }
     engine_->IncreaseWaitingRequestCounter();
 #ifdef ENABLE_HITRACE
     StartTrace(HITRACE_TAG_ACE, "Native async work queueOrdered, " + this->GetTraceDescription());
@@ -199,6 +238,15 @@ bool NativeAsyncWork::Cancel(NativeEngine* engine)
 {
     VALID_ENGINE_CHECK(engine, engine_, engineId_);
 
+    int state = EXECUTOR_QUEUED;
+    if (executorState_.compare_exchange_strong(state, EXECUTOR_CANCELLED)) {
+        // the executor still calls back, the complete callback gets napi_cancelled
+        return true;
+    }
+    if (state != EXECUTOR_IDLE) {
+        HILOG_ERROR("async work is already running on the executor");
+        return false;
+    }
     int status = uv_cancel((uv_req_t*)&work_);
     if (status != 0) {
         HILOG_ERROR("uv_cancel failed");
@@ -207,6 +255,94 @@ bool NativeAsyncWork::Cancel(NativeEngine* engine)
     return true;
 }
 
+bool NativeAsyncWork::RequestCancel(NativeEngine* engine)
+{
+    VALID_ENGINE_CHECK(engine, engine_, engineId_);
+
+    int running = RUN_EXECUTING;
+    if (runState_.compare_exchange_strong(running, RUN_CANCEL_REQUESTED, std::memory_order_acq_rel)) {
+        return true;
+    }
+    if (running == RUN_IDLE && Cancel(engine)) {
+        return true;
+    }
+    // execute may have started after the first check
+    running = RUN_EXECUTING;
+    return runState_.compare_exchange_strong(running, RUN_CANCEL_REQUESTED, std::memory_order_acq_rel);
+}
+
+void NativeAsyncWork::MarkQueued()
+{
+    times_ = NativeTaskTimes();
+    if (engine_->GetTaskLatencyRecorder().IsEnabled()) {
+        times_.queuedNs = NativeTaskLatencyRecorder::Now();
+    }
+}
+
+NativeAsyncExecutor* NativeAsyncWork::GetExecutor() const
+{
+    NativeEngine* loopEngine = engine_->IsMainEnvContext() ? engine_ : engine_->GetParent();
+    // once the channel closed at cleanup the works go to libuv, their completions could not be posted back
+    if (loopEngine == nullptr || loopEngine->GetAsyncCompletionChannel() == nullptr ||
+        !loopEngine->GetAsyncCompletionChannel()->IsOpen()) {
+        return nullptr;
+    }
+    return loopEngine->GetAsyncExecutor();
+}
+
+bool NativeAsyncWork::QueueToExecutor(NativeAsyncExecutor* executor, napi_qos_t qos, uintptr_t queueId)
+{
+    int state = EXECUTOR_IDLE;
+    if (!executorState_.compare_exchange_strong(state, EXECUTOR_QUEUED)) {
+        HILOG_ERROR("async work is already queued");
+        return false;
+    }
+    NativeEngine* loopEngine = engine_->IsMainEnvContext() ? engine_ : engine_->GetParent();
+    channel_ = loopEngine->GetAsyncCompletionChannel();
+    channel_->Hold();
+    engine_->IncreaseWaitingRequestCounter();
+    NativeAsyncTask task { ExecutorCallback, this };
+    bool submitted = queueId != 0 ? executor->SubmitOrdered(qos, queueId, task) : executor->Submit(qos, task);
+    if (!submitted) {
+        HILOG_ERROR("submit to executor failed");
+        engine_->DecreaseWaitingRequestCounter();
+        channel_->Unhold();
+        channel_.reset();
+        executorState_.store(EXECUTOR_IDLE);
+        return false;
+    }
+    HILOG_DEBUG("submit to executor succeed");
+    return true;
+}
+
+void NativeAsyncWork::ExecutorCallback(void* data)
+{
+    auto that = reinterpret_cast<NativeAsyncWork*>(data);
+    int state = EXECUTOR_QUEUED;
+    if (that->executorState_.compare_exchange_strong(state, EXECUTOR_RUNNING)) {
+        AsyncWorkCallback(&that->work_);
+        that->executorState_.store(EXECUTOR_EXECUTED);
+        that->executorStatus_ = 0;
+    } else {
+        that->executorStatus_ = UV_ECANCELED;
+    }
+    // that may be deleted by its complete callback as soon as it is posted
+    auto channel = that->channel_;
+    if (!channel->Post(ExecutorAfterCallback, that)) {
+        HILOG_ERROR("post async work completion failed");
+    }
+}
+
+void NativeAsyncWork::ExecutorAfterCallback(void* data)
+{
+    auto that = reinterpret_cast<NativeAsyncWork*>(data);
+    auto channel = std::move(that->channel_);
+    int status = that->executorStatus_;
+    that->executorState_.store(EXECUTOR_IDLE);
+    AsyncAfterWorkCallback(&that->work_, status);
+    channel->Unhold();
+}
+
 void NativeAsyncWork::AsyncWorkCallback(uv_work_t* req)
 {
     if (req == nullptr) {
@@ -215,7 +351,11 @@ void NativeAsyncWork::AsyncWorkCallback(uv_work_t* req)
     }
 
     auto that = reinterpret_cast<NativeAsyncWork*>(req->data);
+    that->runState_.store(RUN_EXECUTING, std::memory_order_release);
     HILOG_DEBUG("NativeAsyncWork::AsyncWorkCallback start to execute.");
+    if (that->times_.queuedNs != 0) {
+        that->times_.startedNs = NativeTaskLatencyRecorder::Now();
+    }
 
 #ifdef ENABLE_HITRACE
     StartTrace(HITRACE_TAG_ACE, "Native async work execute callback, " + that->GetTraceDescription());
@@ -223,6 +363,7 @@ void NativeAsyncWork::AsyncWorkCallback(uv_work_t* req)
         HiTraceId currentId = HiTraceChain::SaveAndSet(that->taskTraceId_);
         HiTraceChain::Tracepoint(HITRACE_TP_SR, that->taskTraceId_, "%s", TRACE_POINT_ASYNCWORKCALLBACK.c_str());
         that->execute_(that->engine_, that->data_);
+        that->FinishExecute();
         FinishTrace(HITRACE_TAG_ACE);
         HiTraceChain::Tracepoint(HITRACE_TP_SS, that->taskTraceId_, "%s", TRACE_POINT_ASYNCWORKCALLBACK.c_str());
         HiTraceChain::Restore(currentId);
@@ -230,11 +371,21 @@ void NativeAsyncWork::AsyncWorkCallback(uv_work_t* req)
     }
 #endif
     that->execute_(that->engine_, that->data_);
+    that->FinishExecute();
 #ifdef ENABLE_HITRACE
     FinishTrace(HITRACE_TAG_ACE);
 #endif
 }
 
+void NativeAsyncWork::FinishExecute()
+{
+    if (times_.queuedNs != 0) {
+        times_.executedNs = NativeTaskLatencyRecorder::Now();
+    }
+    // a cancel request after this point fails, the result of execute is kept
+    cancelledWhileRunning_ = runState_.exchange(RUN_IDLE, std::memory_order_acq_rel) == RUN_CANCEL_REQUESTED;
+}
+
 void NativeAsyncWork::AsyncAfterWorkCallback(uv_work_t* req, int status)
 {
     if (req == nullptr) {
@@ -261,6 +412,11 @@ void NativeAsyncWork::AsyncAfterWorkCallback(uv_work_t* req, int status)
         default:
             nstatus = napi_generic_failure;
     }
+    // a work cancelled while running reports napi_cancelled too, whether or not execute stopped early
+    if (that->cancelledWhileRunning_ && nstatus == napi_ok) {
+        nstatus = napi_cancelled;
+    }
+    that->cancelledWhileRunning_ = false;
 #ifdef ENABLE_CONTAINER_SCOPE
     NapiContainerScope containerScope(engine, that->containerScopeId_, engine->IsContainerScopeEnabled());
 #endif
@@ -278,7 +434,12 @@ void NativeAsyncWork::AsyncAfterWorkCallback(uv_work_t* req, int status)
     // Don't use that after complete
     auto complete = that->complete_;
     auto description = that->GetTraceDescription();
+    NativeTaskTimes times = that->times_;
+    std::string latencyName = times.queuedNs != 0 ? that->taskName_ : std::string();
     NativeEngine::ExecuteCallback(__FUNCTION__, that->complete_, engine, nstatus, that->data_);
+    if (times.queuedNs != 0) {
+        engine->GetTaskLatencyRecorder().RecordAsyncWork(latencyName, times, NativeTaskLatencyRecorder::Now());
+    }
     if (engine->HasCriticalScope()) {
         HILOG_FATAL("critical scope still open after user callback (ID: %{public}" PRIuPTR
                     ") returned, task description: %{public}s",
@@ -300,3 +461,74 @@ std::string NativeAsyncWork::GetTraceDescription()
 {
     return traceDescription_;
 }
+
+NativeAsyncWorkPool::~NativeAsyncWorkPool()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto work : freeList_) {
+        delete work;
+    }
+    freeList_.clear();
+}
+
+NativeAsyncWork* NativeAsyncWorkPool::Acquire(NativeEngine* engine,
+                                              NativeAsyncExecuteCallback execute,
+                                              NativeAsyncCompleteCallback complete,
+                                              const char* asyncResourceName,
+                                              void* data)
+{
+    NativeAsyncWork* work = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!freeList_.empty()) {
+            work = freeList_.back();
+            freeList_.pop_back();
+        }
+    }
+    if (work == nullptr) {
+        misses_.fetch_add(1, std::memory_order_relaxed);
+        return new NativeAsyncWork(engine, execute, complete, asyncResourceName, data);
+    }
+    hits_.fetch_add(1, std::memory_order_relaxed);
+    work->Init(engine, execute, complete, asyncResourceName, data);
+    return work;
+}
+
+void NativeAsyncWorkPool::Release(NativeAsyncWork* work)
+{
+    if (work == nullptr) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (freeList_.size() < capacity_) {
+            freeList_.push_back(work);
+            return;
+        }
+    }
+    delete work;
+}
+
+void NativeAsyncWorkPool::SetCapacity(size_t capacity)
+{
+    std::vector<NativeAsyncWork*> dropped;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        capacity_ = capacity;
+        if (freeList_.size() > capacity) {
+            dropped.assign(freeList_.begin() + capacity, freeList_.end());
+            freeList_.resize(capacity);
+        }
+    }
+    for (auto work : dropped) {
+        delete work;
+    }
+}
+
+void NativeAsyncWorkPool::GetStats(NativeAsyncWorkPoolStats& stats) const
+{
+    stats.hits = hits_.load(std::memory_order_relaxed);
+    stats.misses = misses_.load(std::memory_order_relaxed);
+    std::lock_guard<std::mutex> lock(mutex_);
+    stats.cached = freeList_.size();
+}
@@ -17,13 +17,18 @@
 #define FOUNDATION_ACE_NAPI_NATIVE_ENGINE_NATIVE_ASYNC_WORK_H
 
 #include "interfaces/kits/napi/common.h"
+#include "native_async_executor.h"
+#include "native_task_latency.h"
 #include "native_value.h"
 #ifdef ENABLE_HITRACE
 #include "hitrace/trace.h"
 #endif
+#include <atomic>
+#include <memory>
 #include <mutex>
 #include <queue>
 #include <uv.h>
+#include <vector>
 
 struct NativeAsyncWorkDataPointer {
     NativeAsyncWorkDataPointer()
@@ -59,6 +64,8 @@ public:
     virtual bool QueueWithQos(NativeEngine* engine, napi_qos_t qos);
     virtual bool QueueOrdered(NativeEngine* engine, napi_qos_t qos, uintptr_t queueId);
     virtual bool Cancel(NativeEngine* engine);
+    // cancels the work like Cancel before execute started, while it runs sets the cancel token instead
+    bool RequestCancel(NativeEngine* engine);
     virtual std::string GetTraceDescription();
     template<typename Inner, typename Outer>
     static Outer* DereferenceOf(const Inner Outer::*field, const Inner* pointer)
@@ -74,10 +81,47 @@ public:
     {
         return taskName_;
     }
+    // cancel token of a running work, polled by long execute callbacks from the work pool thread
+    bool IsCancelRequested() const
+    {
+        return runState_.load(std::memory_order_acquire) == RUN_CANCEL_REQUESTED;
+    }
 
 private:
+    enum ExecutorState : int {
+        EXECUTOR_IDLE = 0,
+        EXECUTOR_QUEUED,
+        EXECUTOR_RUNNING,
+        // execute returned, the completion is on its way to the loop
+        EXECUTOR_EXECUTED,
+        EXECUTOR_CANCELLED,
+    };
+
+    enum RunState : int {
+        RUN_IDLE = 0,
+        RUN_EXECUTING,
+        RUN_CANCEL_REQUESTED,
+    };
+
     static void AsyncWorkCallback(uv_work_t* req);
     static void AsyncAfterWorkCallback(uv_work_t* req, int status);
+    // leaves RUN_EXECUTING as soon as execute returned, so a later cancel can not turn the result into napi_cancelled
+    void FinishExecute();
+    // executor path, used instead of libuv when the loop engine has an async executor installed
+    NativeAsyncExecutor* GetExecutor() const;
+    // stamps the queue time when the latency recording of the engine is on
+    void MarkQueued();
+    bool QueueToExecutor(NativeAsyncExecutor* executor, napi_qos_t qos, uintptr_t queueId = 0);
+    static void ExecutorCallback(void* data);
+    static void ExecutorAfterCallback(void* data);
+
+    friend class NativeAsyncWorkPool;
+    // (re)initializes every per task field, the string members keep their capacity across pooled reuses
+    void Init(NativeEngine* engine,
+              NativeAsyncExecuteCallback execute,
+              NativeAsyncCompleteCallback complete,
+              const char* asyncResourceName,
+              void* data);
 
     uv_work_t work_;
     NativeEngine* engine_;
@@ -89,6 +133,14 @@ private:
     std::queue<NativeAsyncWorkDataPointer> asyncWorkRecvData_;
     std::string traceDescription_;
     std::string taskName_;
+    std::atomic<int> executorState_ { EXECUTOR_IDLE };
+    int executorStatus_ = 0;
+    // RUN_EXECUTING only while execute runs, RequestCancel in that window moves it to RUN_CANCEL_REQUESTED
+    std::atomic<int> runState_ { RUN_IDLE };
+    // set on the work pool thread when execute returned and read by the after callback
+    bool cancelledWhileRunning_ = false;
+    NativeTaskTimes times_;
+    std::shared_ptr<NativeAsyncCompletionChannel> channel_;
 #ifdef ENABLE_CONTAINER_SCOPE
     int32_t containerScopeId_;
 #endif
@@ -97,4 +149,44 @@ private:
 #endif
 };
 
+struct NativeAsyncWorkPoolStats {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    size_t cached = 0;
+};
+
+/*
+ * Per engine free list of deleted NativeAsyncWork objects.
+ * napi_create_async_work takes a cached object when there is one and only re-initializes it, which saves the
+ * allocation of the object, its mutex and queue, and of the task name and trace description strings.
+ */
+class NativeAsyncWorkPool {
+public:
+    static constexpr size_t DEFAULT_CAPACITY = 64;
+
+    explicit NativeAsyncWorkPool(size_t capacity = DEFAULT_CAPACITY) : capacity_(capacity) {}
+    ~NativeAsyncWorkPool();
+
+    NativeAsyncWorkPool(const NativeAsyncWorkPool&) = delete;
+    NativeAsyncWorkPool& operator=(const NativeAsyncWorkPool&) = delete;
+
+    NativeAsyncWork* Acquire(NativeEngine* engine,
+                             NativeAsyncExecuteCallback execute,
+                             NativeAsyncCompleteCallback complete,
+                             const char* asyncResourceName,
+                             void* data);
+    // work must not be queued anymore, it is deleted when the pool is already full
+    void Release(NativeAsyncWork* work);
+    // 0 disables the pooling, cached objects above the new capacity are freed
+    void SetCapacity(size_t capacity);
+    void GetStats(NativeAsyncWorkPoolStats& stats) const;
+
+private:
+    mutable std::mutex mutex_;
+    std::vector<NativeAsyncWork*> freeList_;
+    size_t capacity_;
+    std::atomic<uint64_t> hits_ { 0 };
+    std::atomic<uint64_t> misses_ { 0 };
+};
+
 #endif /* FOUNDATION_ACE_NAPI_NATIVE_ENGINE_NATIVE_ASYNC_WORK_H */
@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "native_async_work_batch.h"
+
+#include <algorithm>
+#include <thread>
+
+#ifdef ENABLE_HITRACE
+#include "hitrace_meter.h"
+#endif
+#ifdef ENABLE_CONTAINER_SCOPE
+#include "native_container_scope.h"
+#endif
+#include "native_api_internal.h"
+
+NativeAsyncWorkBatch::NativeAsyncWorkBatch(NativeEngine* engine,
+                                           NativeAsyncBatchExecuteCallback execute,
+                                           NativeAsyncBatchCompleteCallback complete,
+                                           const std::string& asyncResourceName,
+                                           size_t count,
+                                           void* data,
+                                           bool reportItemStatus)
+    : engine_(engine), engineId_(engine->GetId()), execute_(execute), complete_(complete), data_(data),
+      count_(count), taskName_(asyncResourceName), reportItemStatus_(reportItemStatus)
+{
+    size_t cores = std::max<size_t>(1, std::thread::hardware_concurrency());
+    runners_.resize(std::min({ count, cores, MAX_RUNNER_COUNT }));
+    for (auto& runner : runners_) {
+        runner.work = uv_work_t { 0 };
+        runner.work.data = &runner;
+        runner.batch = this;
+    }
+    if (reportItemStatus_) {
+        itemStatus_.resize(count, napi_cancelled);
+    }
+#ifdef ENABLE_CONTAINER_SCOPE
+    if (engine->IsContainerScopeEnabled()) {
+        containerScopeId_ = engine->GetContainerScopeIdFunc();
+    }
+#endif
+}
+
+bool NativeAsyncWorkBatch::Queue(NativeEngine* engine, napi_qos_t qos)
+{
+    VALID_ENGINE_CHECK(engine, engine_, engineId_);
+
+    if (pendingRunners_ != 0) {
+        HILOG_ERROR("async work batch is still in flight");
+        return false;
+    }
+    uv_loop_t* loop = nullptr;
+    if (engine_->IsMainEnvContext()) {
+        loop = engine_->GetUVLoop();
+    } else {
+        loop = engine_->GetParent()->GetUVLoop();
+    }
+    if (loop == nullptr) {
+        HILOG_ERROR("Get loop failed");
+        return false;
+    }
+
+    nextIndex_.store(0, std::memory_order_relaxed);
+    executed_.store(0, std::memory_order_relaxed);
+    cancelled_.store(false, std::memory_order_relaxed);
+    failed_.store(false, std::memory_order_relaxed);
+    std::fill(itemStatus_.begin(), itemStatus_.end(), napi_cancelled);
+
+    engine_->IncreaseWaitingRequestCounter();
+#ifdef ENABLE_HITRACE
+    StartTrace(HITRACE_TAG_ACE, "Native async work batch queue, name:" + taskName_);
+#endif
+    for (auto& runner : runners_) {
+        int status = uv_queue_work_with_qos_internal(loop, &runner.work, RunnerCallback, RunnerAfterCallback,
+            uv_qos_t(qos), taskName_.c_str());
+        if (status != 0) {
+            // the runners already queued still take every item
+            HILOG_ERROR("uv_queue_work_with_qos failed, %{public}zu of %{public}zu runners queued",
+                pendingRunners_, runners_.size());
+            break;
+        }
+        pendingRunners_++;
+    }
+#ifdef ENABLE_HITRACE
+    FinishTrace(HITRACE_TAG_ACE);
+#endif
+    if (pendingRunners_ == 0) {
+        engine_->DecreaseWaitingRequestCounter();
+        return false;
+    }
+    return true;
+}
+
+bool NativeAsyncWorkBatch::Cancel(NativeEngine* engine)
+{
+    VALID_ENGINE_CHECK(engine, engine_, engineId_);
+
+    if (pendingRunners_ == 0) {
+        HILOG_ERROR("async work batch is not in flight");
+        return false;
+    }
+    cancelled_.store(true, std::memory_order_relaxed);
+    for (auto& runner : runners_) {
+        // fails for the runners which already started, they stop at their next item
+        uv_cancel(reinterpret_cast<uv_req_t*>(&runner.work));
+    }
+    return true;
+}
+
+void NativeAsyncWorkBatch::RunnerCallback(uv_work_t* req)
+{
+    if (req == nullptr) {
+        HILOG_ERROR("req is nullptr");
+        return;
+    }
+    auto that = reinterpret_cast<Runner*>(req->data)->batch;
+    while (!that->cancelled_.load(std::memory_order_relaxed)) {
+        size_t index = that->nextIndex_.fetch_add(1, std::memory_order_relaxed);
+        if (index >= that->count_) {
+            break;
+        }
+        napi_status status = that->execute_(that->engine_, that->data_, index);
+        if (that->reportItemStatus_) {
+            that->itemStatus_[index] = status;
+        }
+        if (status != napi_ok) {
+            that->failed_.store(true, std::memory_order_relaxed);
+        }
+        that->executed_.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void NativeAsyncWorkBatch::RunnerAfterCallback(uv_work_t* req, int status)
+{
+    if (req == nullptr) {
+        HILOG_ERROR("req is nullptr");
+        return;
+    }
+    (void)status;
+    auto that = reinterpret_cast<Runner*>(req->data)->batch;
+    if (--that->pendingRunners_ == 0) {
+        that->Complete();
+    }
+}
+
+void NativeAsyncWorkBatch::Complete()
+{
+    auto engine = engine_;
+    engine->DecreaseWaitingRequestCounter();
+    auto vm = engine->GetEcmaVm();
+    panda::LocalScope scope(vm);
+    napi_status nstatus = napi_ok;
+    if (executed_.load(std::memory_order_relaxed) < count_) {
+        nstatus = napi_cancelled;
+    } else if (failed_.load(std::memory_order_relaxed)) {
+        nstatus = napi_generic_failure;
+    }
+#ifdef ENABLE_CONTAINER_SCOPE
+    NapiContainerScope containerScope(engine, containerScopeId_, engine->IsContainerScopeEnabled());
+#endif
+
+    TryCatch tryCatch(reinterpret_cast<napi_env>(engine));
+#ifdef ENABLE_HITRACE
+    StartTrace(HITRACE_TAG_ACE, "Native async work batch complete callback, name:" + taskName_);
+#endif
+    // Don't use this after complete, it may delete the batch
+    NativeEngine::ExecuteCallback(__FUNCTION__, complete_, engine, nstatus, data_,
+        reportItemStatus_ ? itemStatus_.data() : nullptr, count_);
+    if (tryCatch.HasCaught()) {
+        engine->HandleUncaughtException();
+    }
+#ifdef ENABLE_HITRACE
+    FinishTrace(HITRACE_TAG_ACE);
+#endif
+}
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_NAPI_NATIVE_ENGINE_NATIVE_ASYNC_WORK_BATCH_H
+#define FOUNDATION_ACE_NAPI_NATIVE_ENGINE_NATIVE_ASYNC_WORK_BATCH_H
+
+#include <atomic>
+#include <string>
+#include <uv.h>
+#include <vector>
+
+#include "interfaces/kits/napi/common.h"
+#include "native_value.h"
+
+/*
+ * Data parallel async work: count execute calls submitted as one unit.
+ * The items are not queued one by one, a few runners are queued on the work pool and pull item indices from a
+ * shared counter until every item ran. Only the runners come back to the loop thread, and the complete callback is
+ * called once, after the last of them.
+ */
+class NativeAsyncWorkBatch {
+public:
+    static constexpr size_t MAX_RUNNER_COUNT = 16;
+
+    NativeAsyncWorkBatch(NativeEngine* engine,
+                         NativeAsyncBatchExecuteCallback execute,
+                         NativeAsyncBatchCompleteCallback complete,
+                         const std::string& asyncResourceName,
+                         size_t count,
+                         void* data,
+                         bool reportItemStatus);
+    ~NativeAsyncWorkBatch() = default;
+
+    NativeAsyncWorkBatch(const NativeAsyncWorkBatch&) = delete;
+    NativeAsyncWorkBatch& operator=(const NativeAsyncWorkBatch&) = delete;
+
+    // loop thread only, fails while the batch is still in flight
+    bool Queue(NativeEngine* engine, napi_qos_t qos);
+    // items which did not start yet are skipped and reported as napi_cancelled, running items finish normally
+    bool Cancel(NativeEngine* engine);
+
+    // loop thread only, runners are queued or running, the batch may not be deleted
+    bool IsInFlight() const
+    {
+        return pendingRunners_ != 0;
+    }
+
+    std::string GetTaskName() const
+    {
+        return taskName_;
+    }
+
+    size_t GetRunnerCount() const
+    {
+        return runners_.size();
+    }
+
+private:
+    struct Runner {
+        uv_work_t work;
+        NativeAsyncWorkBatch* batch;
+    };
+
+    static void RunnerCallback(uv_work_t* req);
+    static void RunnerAfterCallback(uv_work_t* req, int status);
+    void Complete();
+
+    NativeEngine* engine_;
+    uint64_t engineId_;
+    NativeAsyncBatchExecuteCallback execute_;
+    NativeAsyncBatchCompleteCallback complete_;
+    void* data_;
+    size_t count_;
+    std::string taskName_;
+    std::vector<Runner> runners_;
+    // written by the runners at distinct indices, read on the loop thread once all of them came back
+    std::vector<napi_status> itemStatus_;
+    bool reportItemStatus_;
+    std::atomic<size_t> nextIndex_ { 0 };
+    std::atomic<size_t> executed_ { 0 };
+    std::atomic<bool> cancelled_ { false };
+    std::atomic<bool> failed_ { false };
+    // loop thread only
+    size_t pendingRunners_ = 0;
+#ifdef ENABLE_CONTAINER_SCOPE
+    int32_t containerScopeId_ = 0;
+#endif
+};
+
+#endif /* FOUNDATION_ACE_NAPI_NATIVE_ENGINE_NATIVE_ASYNC_WORK_BATCH_H */
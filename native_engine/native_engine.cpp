@@ -151,9 +151,47 @@ void NativeEngine::Init()
     }
     uv_async_init(loop_, &uvAsync_, nullptr);
     uv_sem_init(&uvSem_, 0);
+    InitAsyncCompletionChannel();
     NativeEvent::CreateDefaultFunction(this, defaultFunc_, eventMutex_);
 }
 
+void NativeEngine::InitAsyncCompletionChannel()
+{
+    auto channel = std::make_shared<NativeAsyncCompletionChannel>();
+    if (!channel->Init(loop_)) {
+        HILOG_ERROR("failed to init async completion channel, async works use uv work pool");
+        return;
+    }
+    asyncChannel_ = channel;
+}
+
+void NativeEngine::ReportExternalMemory(int64_t changeInBytes)
+{
+    if (!externalMemory_.Add(changeInBytes)) {
+        return;
+    }
+    if (pthread_equal(tid_, pthread_self())) {
+        FlushExternalMemory();
+        return;
+    }
+    // the threshold was crossed on another thread, the js thread is woken once for it and not for every report
+    if (asyncChannel_ == nullptr || !asyncChannel_->Post([](void* data) {
+            reinterpret_cast<NativeEngine*>(data)->FlushExternalMemory();
+        }, this)) {
+        externalMemory_.CancelFlushRequest();
+    }
+}
+
+int64_t NativeEngine::FlushExternalMemory()
+{
+    int64_t delta = externalMemory_.Take();
+    if (delta != 0) {
+        int64_t adjustedValue = 0;
+        AdjustExternalMemory(delta, &adjustedValue);
+    }
+    return externalMemory_.GetTotal();
+}
+
 void NativeEngine::Deinit()
 {
     HILOG_INFO("NativeEngine");
@@ -245,6 +283,12 @@ bool NativeEngine::ReinitUVLoop()
         NativeEvent::DestoryDefaultFunction(true, defaultFunc_, eventMutex_);
     }
 
+    // threads of the executor do not survive the fork, the child goes back to the uv work pool
+    if (asyncChannel_ != nullptr) {
+        asyncChannel_->Close();
+        asyncChannel_.reset();
+    }
+    asyncExecutor_ = nullptr;
     if (loop_ != nullptr) {
         auto const ensureClosing = [](uv_handle_t *handle, void *arg) {
             if (!uv_is_closing(handle)) {
@@ -276,6 +320,7 @@ bool NativeEngine::ReinitUVLoop()
 
     uv_async_init(loop_, &uvAsync_, nullptr);
     uv_sem_init(&uvSem_, 0);
+    InitAsyncCompletionChannel();
     NativeEvent::CreateDefaultFunction(this, defaultFunc_, eventMutex_);
     panda::JSNApi::NotifyEnvInitialized(const_cast<EcmaVM*>(GetEcmaVm()));
     return true;
@@ -346,13 +391,13 @@ NativeAsyncWork* NativeEngine::CreateAsyncWork(napi_value asyncResource, napi_va
             strLength = 0;
         }
     }
-    return new NativeAsyncWork(this, execute, complete, name, data);
+    return asyncWorkPool_.Acquire(this, execute, complete, name, data);
 }
 
 NativeAsyncWork* NativeEngine::CreateAsyncWork(const std::string& asyncResourceName, NativeAsyncExecuteCallback execute,
     NativeAsyncCompleteCallback complete, void* data)
 {
-    return new NativeAsyncWork(this, execute, complete, asyncResourceName, data);
+    return asyncWorkPool_.Acquire(this, execute, complete, asyncResourceName.c_str(), data);
 }
 
 NativeSafeAsyncWork* NativeEngine::CreateSafeAsyncWork(napi_value func, napi_value asyncResource,
@@ -911,6 +956,14 @@ void NativeEngine::RunCleanup()
     // make sure tsfn relese by itself
     uv_run(loop_, UV_RUN_NOWAIT);
 
+    if (asyncChannel_ != nullptr) {
+        // the executor tasks still running complete through the channel, which keeps the loop alive until then
+        while (asyncChannel_->IsHeld()) {
+            uv_run(loop_, UV_RUN_ONCE);
+        }
+        asyncChannel_->Close();
+    }
+
     // Close all unclosed uv handles
     auto const ensureClosing = [](uv_handle_t *handle, void *arg) {
         if (!uv_is_closing(handle)) {
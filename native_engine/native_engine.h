@@ -36,6 +36,7 @@
 #include "native_engine/native_reference.h"
 #include "native_engine/native_safe_async_work.h"
 #include "native_engine/native_event.h"
+#include "native_engine/native_external_memory.h"
 #include "native_engine/native_value.h"
 #include "native_property.h"
 #include "reference_manager/native_reference_manager.h"
@@ -653,6 +654,69 @@ public:
         return instanceId_;
     };
 
+    // default per wakeup drain budget of the threadsafe functions created on this env, 0 means unlimited
+    inline void SetTsfnDrainBudget(size_t maxItems, uint64_t maxTimeUs)
+    {
+        tsfnDrainItemBudget_ = maxItems;
+        tsfnDrainTimeBudgetUs_ = maxTimeUs;
+    }
+
+    inline size_t GetTsfnDrainItemBudget() const
+    {
+        return tsfnDrainItemBudget_;
+    }
+
+    inline uint64_t GetTsfnDrainTimeBudget() const
+    {
+        return tsfnDrainTimeBudgetUs_;
+    }
+
+    inline NativeAsyncWorkPool& GetAsyncWorkPool()
+    {
+        return asyncWorkPool_;
+    }
+
+    // executor taking the async works queued on the loop of this engine, nullptr hands them to libuv
+    inline void SetAsyncExecutor(NativeAsyncExecutor* executor)
+    {
+        asyncExecutor_ = executor;
+    }
+
+    inline NativeAsyncExecutor* GetAsyncExecutor() const
+    {
+        return asyncExecutor_;
+    }
+
+    inline const std::shared_ptr<NativeAsyncCompletionChannel>& GetAsyncCompletionChannel() const
+    {
+        return asyncChannel_;
+    }
+
+    inline NativeTaskLatencyRecorder& GetTaskLatencyRecorder()
+    {
+        return taskLatency_;
+    }
+
+    // napi_wrap keeps the reference on the target object itself instead of a wrapper object where it can
+    inline void SetDirectWrapEnabled(bool enabled)
+    {
+        directWrap_ = enabled;
+    }
+
+    inline bool IsDirectWrapEnabled() const
+    {
+        return directWrap_;
+    }
+
+    inline NativeExternalMemoryAccumulator& GetExternalMemory()
+    {
+        return externalMemory_;
+    }
+    // any thread, the change reaches the vm with the next flush
+    void ReportExternalMemory(int64_t changeInBytes);
+    // js thread, hands the pending change to the vm and returns the external memory of the engine
+    int64_t FlushExternalMemory();
+
     template <typename T, typename... Args>
     static inline void ExecuteCallback(const std::string& func, T&& call, Args... args) {
         panda::ArkCrashHolder holder("NAPI", func);
@@ -723,6 +787,7 @@ private:
     bool crossThreadCheck_ = false;
     NativeObjectInfo instanceDataInfo_;
     void FinalizerInstanceData(void);
+    void InitAsyncCompletionChannel();
     pthread_t tid_ { 0 };
     ThreadId sysTid_ { 0 };
     uint64_t id_ { 0 };
@@ -745,6 +810,14 @@ private:
     napi_threadsafe_function defaultFunc_ = nullptr;
     // Record the instance of FA model to find the correct ArkUI instance while posting cross-thread task
     int32_t instanceId_ = -1;
+    size_t tsfnDrainItemBudget_ = 0;
+    uint64_t tsfnDrainTimeBudgetUs_ = 0;
+    NativeAsyncWorkPool asyncWorkPool_;
+    NativeAsyncExecutor* asyncExecutor_ = nullptr;
+    std::shared_ptr<NativeAsyncCompletionChannel> asyncChannel_;
+    NativeTaskLatencyRecorder taskLatency_;
+    bool directWrap_ = false;
+    NativeExternalMemoryAccumulator externalMemory_;
     PostTask postTask_ = nullptr;
     CleanEnv cleanEnv_ = nullptr;
     uv_async_t uvAsync_;
@@ -34,6 +34,18 @@ using namespace OHOS::AppExecFwk;
 static constexpr uint64_t INVALID_EVENT_ID = std::numeric_limits<uint64_t>::max();
 static constexpr const char DEFAULT_NAME[] = "defaultName";
 
+// napi_event_priority has an extra vip level in front of the napi_task_priority ones the lanes follow
+static SafeAsyncLane EventPriorityToLane(int32_t priority)
+{
+    if (priority <= napi_eprio_immediate) {
+        return SafeAsyncLane::IMMEDIATE;
+    }
+    if (priority >= napi_eprio_idle) {
+        return SafeAsyncLane::IDLE;
+    }
+    return static_cast<SafeAsyncLane>(priority - napi_eprio_immediate);
+}
+
 // trace and log
 class TraceLogClass {
 #ifdef ENABLE_HITRACE
@@ -183,6 +195,9 @@ static void ThreadSafeCallback(napi_env env, napi_value jsCallback, void* contex
 {
     if (data != nullptr) {
         CallbackWrapper *cbw = static_cast<CallbackWrapper *>(data);
+        if (cbw->owner != nullptr) {
+            cbw->owner->UnregisterUvEvent(cbw);
+        }
         uint64_t expected = cbw->handleId.load(std::memory_order_acquire);
         if (expected != INVALID_EVENT_ID &&
             cbw->handleId.compare_exchange_strong(expected, INVALID_EVENT_ID,
@@ -288,7 +303,7 @@ napi_status NativeEvent::SendCancelableEvent(const std::function<void(void*)> &c
         if (sentEventRes != napi_status::napi_invalid_arg) {
             return sentEventRes;
         }
-        return SendEventByUv(task, eventId, name, handleId);
+        return SendEventByUv(task, eventId, priority, name, handleId);
     }
 #endif
     std::function<void()> task = [eng = engine_, callback, data, eventId]() {
@@ -304,7 +319,7 @@ napi_status NativeEvent::SendCancelableEvent(const std::function<void(void*)> &c
         return sentEventOut;
     }
 
-    return SendEventByUv(task, eventId, name, handleId);
+    return SendEventByUv(task, eventId, priority, name, handleId);
 }
 
 napi_status NativeEvent::SendEventByEventHandler(const std::function<void()> &task, uint64_t eventId,
@@ -339,7 +354,7 @@ napi_status NativeEvent::SendEventByEventHandler(const std::function<void()> &ta
     return napi_status::napi_invalid_arg;
 }
 
-napi_status NativeEvent::SendEventByUv(const std::function<void()> &task, uint64_t eventId,
+napi_status NativeEvent::SendEventByUv(const std::function<void()> &task, uint64_t eventId, int32_t priority,
                                        const char* name, uint64_t* handleId)
 {
     CallbackWrapper* cbw = new (std::nothrow) CallbackWrapper();
@@ -354,13 +369,16 @@ napi_status NativeEvent::SendEventByUv(const std::function<void()> &task, uint64
     };
     cbw->cb = incCountTask;
     cbw->handleId.store(eventId, std::memory_order_release);
-    napi_status status = SendConvertStatus2NapiStatus(reinterpret_cast<void *>(cbw), NATIVE_TSFUNC_NONBLOCKING);
+    cbw->owner = this;
+    RegisterUvEvent(cbw, eventId);
+    napi_status status = SendConvertStatus2NapiStatus(reinterpret_cast<void *>(cbw), EventPriorityToLane(priority));
     *handleId = eventId;
     std::string res = (status == napi_status::napi_ok? "ok": "fail");
     auto uvt = TraceLogClass(
         "uv Send task:" + std::string(name) + " | handleId:" + std::to_string(eventId) + " | postRes: " + res);
     if (status != napi_status::napi_ok) {
         HILOG_ERROR("send event failed(%{public}d)", status);
+        UnregisterUvEvent(cbw);
         delete cbw;
         *handleId = 0;
         engine_->DecreaseWaitingRequestCounter();
@@ -394,7 +412,6 @@ napi_status NativeEvent::CancelEvent(const char* name, uint64_t handleId)
 
 SafeAsyncCode NativeEvent::UvCancelEvent(uint64_t handleId)
 {
-    std::unique_lock<std::mutex> lock(mutex_);
     if (status_ == SafeAsyncStatus::SAFE_ASYNC_STATUS_CLOSED ||
         status_ == SafeAsyncStatus::SAFE_ASYNC_STATUS_CLOSING) {
         HILOG_WARN("Do not cancel, thread is closed!");
@@ -405,28 +422,44 @@ SafeAsyncCode NativeEvent::UvCancelEvent(uint64_t handleId)
         return SafeAsyncCode::SAFE_ASYNC_FAILED;
     }
 
-    for (const auto &current : queue_) {
-        if (current == nullptr) {
-            continue;
-        }
-        CallbackWrapper* cbw = reinterpret_cast<CallbackWrapper *>(current);
-        if (cbw->handleId.load(std::memory_order_relaxed) != handleId) {
-            continue;
-        }
-        if (cbw->handleId.compare_exchange_strong(handleId, INVALID_EVENT_ID,
-                                                  std::memory_order_acq_rel, std::memory_order_relaxed)) {
-            engine_->DecreaseWaitingRequestCounter();
-            return SafeAsyncCode::SAFE_ASYNC_OK;
-        }
-        HILOG_WARN("UvCancelEvent false %{public}s", std::to_string(handleId).c_str());
+    std::lock_guard<std::mutex> eventLock(uvEventMutex_);
+    CallbackWrapper* cbw = uvEvents_.Find(handleId);
+    if (cbw == nullptr) {
         return SafeAsyncCode::SAFE_ASYNC_FAILED;
     }
+    // the wrapper stays in the uv queue as a tombstone, the drain frees it without running the callback
+    if (cbw->handleId.compare_exchange_strong(handleId, INVALID_EVENT_ID,
+                                              std::memory_order_acq_rel, std::memory_order_relaxed)) {
+        uvEvents_.Erase(handleId, cbw);
+        engine_->DecreaseWaitingRequestCounter();
+        return SafeAsyncCode::SAFE_ASYNC_OK;
+    }
+    HILOG_WARN("UvCancelEvent false %{public}s", std::to_string(handleId).c_str());
     return SafeAsyncCode::SAFE_ASYNC_FAILED;
 }
 
-napi_status NativeEvent::SendConvertStatus2NapiStatus(void* data, NativeThreadSafeFunctionCallMode mode)
+void NativeEvent::RegisterUvEvent(CallbackWrapper* cbw, uint64_t eventId)
+{
+    std::lock_guard<std::mutex> eventLock(uvEventMutex_);
+    uvEvents_.Insert(eventId, cbw);
+}
+
+void NativeEvent::UnregisterUvEvent(CallbackWrapper* cbw)
+{
+    // must run before the wrapper is released, UvCancelEvent only touches wrappers found in the index
+    uint64_t eventId = cbw->handleId.load(std::memory_order_acquire);
+    if (eventId == INVALID_EVENT_ID) {
+        // canceled, UvCancelEvent already dropped it from the index
+        return;
+    }
+    std::lock_guard<std::mutex> eventLock(uvEventMutex_);
+    uvEvents_.Erase(eventId, cbw);
+}
+
+napi_status NativeEvent::SendConvertStatus2NapiStatus(void* data, SafeAsyncLane lane)
 {
-    auto code = Send(data, mode);
+    // napi_send_event callers never acquire the default function, so no thread is released when it is closed
+    auto code = SendToLane(data, lane, true, false);
     napi_status status = napi_status::napi_ok;
     switch (code) {
         case SafeAsyncCode::SAFE_ASYNC_OK:
@@ -18,11 +18,15 @@
 #include <cstdint>
 #include <shared_mutex>
 #include <string>
+#include "native_event_index.h"
 #include "native_safe_async_work.h"
 
+class NativeEvent;
+
 typedef struct CallbackWrapper_ {
     std::function<void()> cb;
     std::atomic<uint64_t> handleId;
+    NativeEvent* owner = nullptr;
 } CallbackWrapper;
 
 class NativeEvent : public NativeSafeAsyncWork {
@@ -46,6 +50,7 @@ public:
                                             int32_t option = 0);
     virtual napi_status CancelEvent(const char* name, uint64_t handleId);
     virtual SafeAsyncCode UvCancelEvent(uint64_t handleId);
+    void UnregisterUvEvent(CallbackWrapper* cbw);
     static void CreateDefaultFunction(NativeEngine* eng, napi_threadsafe_function &defaultFunc,
                                       std::shared_mutex &eventMutex);
     static void DestoryDefaultFunction(bool release, napi_threadsafe_function &defaultFunc,
@@ -57,8 +62,13 @@ protected:
     napi_status SendEventByEventHandler(const std::function<void()> &task, uint64_t eventId,
                                         int32_t priority, const char* name, uint64_t* handleId,
                                         int32_t option = 0);
-    napi_status SendEventByUv(const std::function<void()> &task, uint64_t eventId,
+    napi_status SendEventByUv(const std::function<void()> &task, uint64_t eventId, int32_t priority,
                               const char* name, uint64_t* handleId);
-    napi_status SendConvertStatus2NapiStatus(void* data, NativeThreadSafeFunctionCallMode mode);
+    napi_status SendConvertStatus2NapiStatus(void* data, SafeAsyncLane lane);
+    void RegisterUvEvent(CallbackWrapper* cbw, uint64_t eventId);
+
+    // the uv queue is lock-free and can not be searched, pending cancelable events are indexed here instead
+    std::mutex uvEventMutex_;
+    NativeEventIndex<CallbackWrapper> uvEvents_;
 };
 #endif /* FOUNDATION_ACE_NAPI_NATIVE_ENGINE_NATIVE_EVENT_H */
\ No newline at end of file
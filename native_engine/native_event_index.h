@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_NAPI_NATIVE_ENGINE_NATIVE_EVENT_INDEX_H
+#define FOUNDATION_ACE_NAPI_NATIVE_ENGINE_NATIVE_EVENT_INDEX_H
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+
+/*
+ * Open addressing handleId -> value table with linear probing, not thread-safe.
+ * Event ids are never 0 nor UINT64_MAX, they mark empty and erased slots. Erasing only leaves a tombstone so the
+ * probe chains of other keys stay intact, tombstones are reused by inserts and dropped when the table is rebuilt.
+ */
+template<typename T>
+class NativeEventIndex {
+public:
+    static constexpr uint64_t EMPTY_KEY = 0;
+    static constexpr uint64_t TOMBSTONE_KEY = std::numeric_limits<uint64_t>::max();
+
+    NativeEventIndex()
+    {
+        Rebuild(MIN_CAPACITY);
+    }
+    ~NativeEventIndex() = default;
+
+    NativeEventIndex(const NativeEventIndex&) = delete;
+    NativeEventIndex& operator=(const NativeEventIndex&) = delete;
+
+    bool Insert(uint64_t key, T* value)
+    {
+        if (key == EMPTY_KEY || key == TOMBSTONE_KEY) {
+            return false;
+        }
+        if ((size_ + tombstones_ + 1) * MAX_LOAD_DEN > capacity_ * MAX_LOAD_NUM) {
+            // only grow when live entries need it, otherwise rebuilding just clears the tombstones
+            Rebuild((size_ + 1) * MAX_LOAD_DEN > capacity_ * MAX_LOAD_NUM / GROW_FACTOR ?
+                    capacity_ * GROW_FACTOR : capacity_);
+        }
+        size_t reuse = capacity_;
+        for (size_t index = Hash(key);; index = (index + 1) & (capacity_ - 1)) {
+            Slot& slot = slots_[index];
+            if (slot.key == key) {
+                slot.value = value;
+                return true;
+            }
+            if (slot.key == TOMBSTONE_KEY && reuse == capacity_) {
+                reuse = index;
+            } else if (slot.key == EMPTY_KEY) {
+                if (reuse != capacity_) {
+                    index = reuse;
+                    tombstones_--;
+                }
+                slots_[index].key = key;
+                slots_[index].value = value;
+                size_++;
+                return true;
+            }
+        }
+    }
+
+    T* Find(uint64_t key) const
+    {
+        size_t index = FindSlot(key);
+        return index == capacity_ ? nullptr : slots_[index].value;
+    }
+
+    // erases key only when it still maps to expected, a null expected erases any value
+    T* Erase(uint64_t key, const T* expected = nullptr)
+    {
+        size_t index = FindSlot(key);
+        if (index == capacity_ || (expected != nullptr && slots_[index].value != expected)) {
+            return nullptr;
+        }
+        T* value = slots_[index].value;
+        slots_[index].key = TOMBSTONE_KEY;
+        slots_[index].value = nullptr;
+        size_--;
+        tombstones_++;
+        return value;
+    }
+
+    size_t Size() const
+    {
+        return size_;
+    }
+
+    size_t Capacity() const
+    {
+        return capacity_;
+    }
+
+private:
+    static constexpr size_t MIN_CAPACITY = 64;
+    static constexpr size_t GROW_FACTOR = 2;
+    // rebuild once live entries and tombstones take 3/4 of the slots
+    static constexpr size_t MAX_LOAD_NUM = 3;
+    static constexpr size_t MAX_LOAD_DEN = 4;
+    static constexpr uint64_t HASH_MULTIPLIER = 0x9E3779B97F4A7C15ULL;
+
+    struct Slot {
+        uint64_t key = EMPTY_KEY;
+        T* value = nullptr;
+    };
+
+    size_t Hash(uint64_t key) const
+    {
+        // ids are sequential, fibonacci hashing spreads them over the whole table
+        return static_cast<size_t>((key * HASH_MULTIPLIER) >> shift_);
+    }
+
+    size_t FindSlot(uint64_t key) const
+    {
+        if (key == EMPTY_KEY || key == TOMBSTONE_KEY) {
+            return capacity_;
+        }
+        for (size_t index = Hash(key);; index = (index + 1) & (capacity_ - 1)) {
+            if (slots_[index].key == key) {
+                return index;
+            }
+            if (slots_[index].key == EMPTY_KEY) {
+                return capacity_;
+            }
+        }
+    }
+
+    void Rebuild(size_t capacity)
+    {
+        std::unique_ptr<Slot[]> oldSlots = std::move(slots_);
+        size_t oldCapacity = capacity_;
+        slots_ = std::make_unique<Slot[]>(capacity);
+        capacity_ = capacity;
+        shift_ = std::numeric_limits<uint64_t>::digits;
+        for (size_t bits = capacity; bits > 1; bits >>= 1) {
+            shift_--;
+        }
+        tombstones_ = 0;
+        for (size_t i = 0; i < oldCapacity; ++i) {
+            const Slot& slot = oldSlots[i];
+            if (slot.key == EMPTY_KEY || slot.key == TOMBSTONE_KEY) {
+                continue;
+            }
+            size_t index = Hash(slot.key);
+            while (slots_[index].key != EMPTY_KEY) {
+                index = (index + 1) & (capacity_ - 1);
+            }
+            slots_[index] = slot;
+        }
+    }
+
+    std::unique_ptr<Slot[]> slots_;
+    size_t capacity_ = 0;
+    size_t shift_ = 0;
+    size_t size_ = 0;
+    size_t tombstones_ = 0;
+};
+
+#endif /* FOUNDATION_ACE_NAPI_NATIVE_ENGINE_NATIVE_EVENT_INDEX_H */
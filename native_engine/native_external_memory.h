@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_NAPI_NATIVE_ENGINE_NATIVE_EXTERNAL_MEMORY_H
+#define FOUNDATION_ACE_NAPI_NATIVE_ENGINE_NATIVE_EXTERNAL_MEMORY_H
+
+#include <atomic>
+#include <cstdint>
+
+/*
+ * External memory changes of an engine reported from any thread, without a lock. They add up in a pending delta
+ * which the js thread takes and hands to the vm, at the next gc or once the delta moved THRESHOLD bytes away from 0,
+ * then a single flush is requested until the js thread took it.
+ */
+class NativeExternalMemoryAccumulator {
+public:
+    static constexpr int64_t DEFAULT_FLUSH_THRESHOLD = 1024 * 1024;
+
+    NativeExternalMemoryAccumulator() = default;
+    ~NativeExternalMemoryAccumulator() = default;
+
+    NativeExternalMemoryAccumulator(const NativeExternalMemoryAccumulator&) = delete;
+    NativeExternalMemoryAccumulator& operator=(const NativeExternalMemoryAccumulator&) = delete;
+
+    // any thread, returns true when the caller has to request a flush
+    bool Add(int64_t delta)
+    {
+        int64_t pending = pending_.fetch_add(delta, std::memory_order_relaxed) + delta;
+        int64_t threshold = threshold_.load(std::memory_order_relaxed);
+        if (pending < threshold && pending > -threshold) {
+            return false;
+        }
+        return !flushRequested_.exchange(true, std::memory_order_relaxed);
+    }
+
+    // js thread, returns the delta not handed to the vm yet and counts it as flushed
+    int64_t Take()
+    {
+        flushRequested_.store(false, std::memory_order_relaxed);
+        if (pending_.load(std::memory_order_relaxed) == 0) {
+            return 0;
+        }
+        int64_t delta = pending_.exchange(0, std::memory_order_relaxed);
+        flushed_.fetch_add(delta, std::memory_order_relaxed);
+        return delta;
+    }
+
+    // a request which could not be delivered is dropped, the next crossing asks again
+    void CancelFlushRequest()
+    {
+        flushRequested_.store(false, std::memory_order_relaxed);
+    }
+
+    void SetThreshold(int64_t threshold)
+    {
+        threshold_.store(threshold, std::memory_order_relaxed);
+    }
+
+    int64_t GetThreshold() const
+    {
+        return threshold_.load(std::memory_order_relaxed);
+    }
+
+    // the flushed and the pending bytes, a change being added by another thread may be seen partly
+    int64_t GetTotal() const
+    {
+        return flushed_.load(std::memory_order_relaxed) + pending_.load(std::memory_order_relaxed);
+    }
+
+    int64_t GetPending() const
+    {
+        return pending_.load(std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic<int64_t> pending_ { 0 };
+    std::atomic<int64_t> flushed_ { 0 };
+    std::atomic<int64_t> threshold_ { DEFAULT_FLUSH_THRESHOLD };
+    std::atomic<bool> flushRequested_ { false };
+};
+
+#endif /* FOUNDATION_ACE_NAPI_NATIVE_ENGINE_NATIVE_EXTERNAL_MEMORY_H */
@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "native_finalizer_profiler.h"
+
+#include <algorithm>
+#include <map>
+#if !defined(WINDOWS_PLATFORM)
+#include <dlfcn.h>
+#endif
+#include <vector>
+
+#include "native_json_writer.h"
+
+namespace {
+constexpr uint64_t NS_PER_US = 1000;
+
+struct FinalizerCostEntry {
+    std::string module;
+    std::string symbol;
+    // address relative to the module base, for symbolizing callbacks which are not exported
+    uintptr_t offset = 0;
+    uint64_t count = 0;
+    uint64_t totalNs = 0;
+    uint64_t maxNs = 0;
+};
+
+void ResolveCallback(uintptr_t address, FinalizerCostEntry& entry)
+{
+    entry.offset = address;
+#if !defined(WINDOWS_PLATFORM)
+    Dl_info info;
+    if (dladdr(reinterpret_cast<void*>(address), &info) == 0) {
+        return;
+    }
+    if (info.dli_fname != nullptr) {
+        entry.module = info.dli_fname;
+    }
+    if (info.dli_sname != nullptr) {
+        entry.symbol = info.dli_sname;
+    }
+    entry.offset = address - reinterpret_cast<uintptr_t>(info.dli_fbase);
+#endif
+}
+
+void AppendFinalizerCosts(std::string& out, const char* key, const std::vector<FinalizerCostEntry>& entries)
+{
+    out += '"';
+    out += key;
+    out += "\":[";
+    for (size_t i = 0; i < entries.size(); ++i) {
+        const auto& entry = entries[i];
+        if (i != 0) {
+            out += ',';
+        }
+        out += "{\"module\":";
+        NativeJsonWriter::AppendString(out, entry.module);
+        out += ",\"symbol\":";
+        NativeJsonWriter::AppendString(out, entry.symbol);
+        out += ',';
+        NativeJsonWriter::AppendNumber(out, "offset", entry.offset);
+        out += ',';
+        NativeJsonWriter::AppendNumber(out, "count", entry.count);
+        out += ',';
+        NativeJsonWriter::AppendNumber(out, "totalUs", entry.totalNs / NS_PER_US);
+        out += ',';
+        NativeJsonWriter::AppendNumber(out, "maxUs", entry.maxNs / NS_PER_US);
+        out += ',';
+        NativeJsonWriter::AppendNumber(out, "avgUs", entry.totalNs / entry.count / NS_PER_US);
+        out += '}';
+    }
+    out += ']';
+}
+} // namespace
+
+NativeFinalizerProfiler& NativeFinalizerProfiler::GetInstance()
+{
+    static NativeFinalizerProfiler instance;
+    return instance;
+}
+
+void NativeFinalizerProfiler::Record(const void* callback, uint64_t durationNs)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = costs_.find(reinterpret_cast<uintptr_t>(callback));
+    if (iter == costs_.end()) {
+        if (costs_.size() >= MAX_CALLBACKS) {
+            dropped_++;
+            return;
+        }
+        iter = costs_.emplace(reinterpret_cast<uintptr_t>(callback), Cost()).first;
+    }
+    iter->second.count++;
+    iter->second.totalNs += durationNs;
+    iter->second.maxNs = std::max(iter->second.maxNs, durationNs);
+}
+
+std::string NativeFinalizerProfiler::DumpJson(size_t topN) const
+{
+    std::unordered_map<uintptr_t, Cost> costs;
+    uint64_t dropped = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        costs = costs_;
+        dropped = dropped_;
+    }
+    // dladdr takes the loader lock, so it is left out of mutex_
+    std::map<std::string, FinalizerCostEntry> merged;
+    for (const auto& [address, cost] : costs) {
+        FinalizerCostEntry entry;
+        ResolveCallback(address, entry);
+        std::string key = entry.module + '!' + (entry.symbol.empty() ? std::to_string(entry.offset) : entry.symbol);
+        auto [iter, inserted] = merged.try_emplace(key, std::move(entry));
+        iter->second.count += cost.count;
+        iter->second.totalNs += cost.totalNs;
+        iter->second.maxNs = std::max(iter->second.maxNs, cost.maxNs);
+    }
+    std::vector<FinalizerCostEntry> slowest;
+    slowest.reserve(merged.size());
+    for (auto& [key, entry] : merged) {
+        slowest.emplace_back(std::move(entry));
+    }
+    std::vector<FinalizerCostEntry> frequent = slowest;
+    size_t count = std::min(topN, slowest.size());
+    std::partial_sort(slowest.begin(), slowest.begin() + count, slowest.end(),
+        [](const FinalizerCostEntry& a, const FinalizerCostEntry& b) { return a.maxNs > b.maxNs; });
+    slowest.resize(count);
+    std::partial_sort(frequent.begin(), frequent.begin() + count, frequent.end(),
+        [](const FinalizerCostEntry& a, const FinalizerCostEntry& b) { return a.count > b.count; });
+    frequent.resize(count);
+
+    std::string out = "{";
+    NativeJsonWriter::AppendNumber(out, "dropped", dropped);
+    out += ',';
+    AppendFinalizerCosts(out, "slowest", slowest);
+    out += ',';
+    AppendFinalizerCosts(out, "mostFrequent", frequent);
+    out += '}';
+    return out;
+}
+
+void NativeFinalizerProfiler::Reset()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    costs_.clear();
+    dropped_ = 0;
+}
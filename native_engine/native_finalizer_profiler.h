@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_NAPI_NATIVE_ENGINE_NATIVE_FINALIZER_PROFILER_H
+#define FOUNDATION_ACE_NAPI_NATIVE_ENGINE_NATIVE_FINALIZER_PROFILER_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+/*
+ * Process wide cost of finalizer callbacks, keyed by the callback address, as finalizers of all engines run on shared
+ * workers too. Profiling is off by default, then the finalizer runners take no timestamps. Addresses are resolved to
+ * module and symbol only when dumped, where the callbacks of the same symbol are merged. Callbacks beyond
+ * MAX_CALLBACKS are counted as dropped.
+ */
+class NativeFinalizerProfiler {
+public:
+    static constexpr size_t MAX_CALLBACKS = 1024;
+
+    NativeFinalizerProfiler(const NativeFinalizerProfiler&) = delete;
+    NativeFinalizerProfiler& operator=(const NativeFinalizerProfiler&) = delete;
+
+    static NativeFinalizerProfiler& GetInstance();
+
+    void SetEnabled(bool enabled)
+    {
+        enabled_.store(enabled, std::memory_order_relaxed);
+    }
+
+    bool IsEnabled() const
+    {
+        return enabled_.load(std::memory_order_relaxed);
+    }
+
+    void Record(const void* callback, uint64_t durationNs);
+    // the topN callbacks with the longest single run and the topN most frequent ones
+    std::string DumpJson(size_t topN) const;
+    void Reset();
+
+private:
+    struct Cost {
+        uint64_t count = 0;
+        uint64_t totalNs = 0;
+        uint64_t maxNs = 0;
+    };
+
+    NativeFinalizerProfiler() = default;
+    ~NativeFinalizerProfiler() = default;
+
+    std::atomic<bool> enabled_ { false };
+    mutable std::mutex mutex_;
+    std::unordered_map<uintptr_t, Cost> costs_;
+    uint64_t dropped_ = 0;
+};
+
+#endif /* FOUNDATION_ACE_NAPI_NATIVE_ENGINE_NATIVE_FINALIZER_PROFILER_H */
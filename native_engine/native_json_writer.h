@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_NAPI_NATIVE_ENGINE_NATIVE_JSON_WRITER_H
+#define FOUNDATION_ACE_NAPI_NATIVE_ENGINE_NATIVE_JSON_WRITER_H
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+// appends to the json dumps of the task latency recorder, the finalizer profiler and the reference sampler
+class NativeJsonWriter {
+public:
+    static void AppendString(std::string& out, const std::string& value)
+    {
+        out += '"';
+        for (char c : value) {
+            switch (c) {
+                case '"':
+                    out += "\\\"";
+                    break;
+                case '\\':
+                    out += "\\\\";
+                    break;
+                case '\n':
+                    out += "\\n";
+                    break;
+                case '\r':
+                    out += "\\r";
+                    break;
+                case '\t':
+                    out += "\\t";
+                    break;
+                default:
+                    if (static_cast<unsigned char>(c) < 0x20) {
+                        char escaped[8] = { 0 };
+                        snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned int>(c));
+                        out += escaped;
+                    } else {
+                        out += c;
+                    }
+            }
+        }
+        out += '"';
+    }
+
+    static void AppendNumber(std::string& out, const char* key, uint64_t value)
+    {
+        out += '"';
+        out += key;
+        out += "\":";
+        out += std::to_string(value);
+    }
+};
+
+#endif /* FOUNDATION_ACE_NAPI_NATIVE_ENGINE_NATIVE_JSON_WRITER_H */
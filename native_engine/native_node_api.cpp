@@ -13,10 +13,16 @@
  * limitations under the License.
  */
 
+#include <algorithm>
+
 #include "native_api_internal.h"
 #include "native_engine/native_async_hook_context.h"
+#include "native_engine/native_async_work_batch.h"
+#include "native_engine/native_finalizer_profiler.h"
+#include "native_engine/native_reference_sampler.h"
 #include "native_engine/native_utils.h"
 #include "native_engine/impl/ark/ark_native_engine.h"
+#include "securec.h"
 
 using panda::Local;
 using panda::StringRef;
@@ -146,7 +152,7 @@ NAPI_EXTERN napi_status napi_create_async_work(napi_env env,
         int copied = nativeString->WriteUtf8(ecmaVm, name, 63, true) - 1;  // 63:NAME_BUFFER_SIZE
         name[copied] = '\0';
     }
-    auto asyncWork  = new NativeAsyncWork(engine, asyncExecute, asyncComplete, name, data);
+    auto asyncWork = engine->GetAsyncWorkPool().Acquire(engine, asyncExecute, asyncComplete, name, data);
     *result = reinterpret_cast<napi_async_work>(asyncWork);
     return napi_status::napi_ok;
 }
@@ -156,8 +162,9 @@ NAPI_EXTERN napi_status napi_delete_async_work(napi_env env, napi_async_work wor
     CHECK_ENV(env);
     CHECK_ARG(env, work);
 
+    // the pool of env is used rather than the one of the engine the work was created on, which may be gone
     auto asyncWork = reinterpret_cast<NativeAsyncWork*>(work);
-    delete asyncWork;
+    reinterpret_cast<NativeEngine*>(env)->GetAsyncWorkPool().Release(asyncWork);
     asyncWork = nullptr;
 
     return napi_status::napi_ok;
@@ -400,16 +407,9 @@ NAPI_EXTERN napi_status napi_create_threadsafe_function(napi_env env, napi_value
     return napi_status::napi_ok;
 }
 
-NAPI_EXTERN napi_status napi_call_threadsafe_function(
-    napi_threadsafe_function func, void* data, napi_threadsafe_function_call_mode is_blocking)
+static napi_status SafeAsyncCodeToNapiStatus(SafeAsyncCode code)
 {
-    CHECK_ENV(func);
-
-    auto safeAsyncWork = reinterpret_cast<NativeSafeAsyncWork*>(func);
-    auto callMode = static_cast<NativeThreadSafeFunctionCallMode>(is_blocking);
-
     napi_status status = napi_status::napi_ok;
-    auto code = safeAsyncWork->Send(data, callMode);
     switch (code) {
         case SafeAsyncCode::SAFE_ASYNC_OK:
             status = napi_status::napi_ok;
@@ -434,6 +434,463 @@ NAPI_EXTERN napi_status napi_call_threadsafe_function(
     return status;
 }
 
+NAPI_EXTERN napi_status napi_create_threadsafe_function_with_batch_call_js(napi_env env, napi_value func,
+    napi_value async_resource, napi_value async_resource_name, size_t max_queue_size, size_t initial_thread_count,
+    void* thread_finalize_data, napi_finalize thread_finalize_cb, void* context,
+    napi_threadsafe_function_call_js_batch call_js_batch_cb, napi_threadsafe_function* result)
+{
+    CHECK_ENV(env);
+    CHECK_ARG(env, async_resource_name);
+    RETURN_STATUS_IF_FALSE(
+        env, initial_thread_count > 0 && initial_thread_count <= MAX_THREAD_SAFE_COUNT, napi_invalid_arg);
+    CHECK_ARG(env, call_js_batch_cb);
+    CHECK_ARG(env, result);
+
+    SWITCH_CONTEXT(env);
+    auto finalizeCallback = reinterpret_cast<NativeFinalize>(thread_finalize_cb);
+    auto callJsBatchCallback = reinterpret_cast<NativeThreadSafeFunctionCallJsBatch>(call_js_batch_cb);
+    auto safeAsyncWork = engine->CreateSafeAsyncWork(func, async_resource, async_resource_name, max_queue_size,
+        initial_thread_count, thread_finalize_data, finalizeCallback, context, nullptr);
+    CHECK_ENV(safeAsyncWork);
+    safeAsyncWork->SetCallJsBatchCallback(callJsBatchCallback);
+
+    auto ret = safeAsyncWork->Init();
+    if (ret) {
+        *result = reinterpret_cast<napi_threadsafe_function>(safeAsyncWork);
+    } else {
+        return napi_status::napi_generic_failure;
+    }
+
+    return napi_status::napi_ok;
+}
+
+NAPI_EXTERN napi_status napi_create_threadsafe_function_with_flow_control(napi_env env, napi_value func,
+    napi_value async_resource, napi_value async_resource_name, size_t max_queue_size, size_t initial_thread_count,
+    void* thread_finalize_data, napi_finalize thread_finalize_cb, void* context,
+    napi_threadsafe_function_call_js call_js_cb, const napi_threadsafe_function_flow_control* flow_control,
+    napi_threadsafe_function* result)
+{
+    CHECK_ENV(env);
+    CHECK_ARG(env, async_resource_name);
+    RETURN_STATUS_IF_FALSE(
+        env, initial_thread_count > 0 && initial_thread_count <= MAX_THREAD_SAFE_COUNT, napi_invalid_arg);
+    CHECK_ARG(env, flow_control);
+    CHECK_ARG(env, result);
+    if (func == nullptr) {
+        CHECK_ARG(env, call_js_cb);
+    }
+
+    NativeSafeAsyncFlowControl flowControl;
+    flowControl.highWatermark = flow_control->high_watermark;
+    flowControl.lowWatermark = flow_control->low_watermark;
+    flowControl.watermarkCallback = reinterpret_cast<NativeThreadSafeFunctionWatermark>(flow_control->watermark_cb);
+    flowControl.blockingTimeoutMs = flow_control->blocking_timeout_ms;
+    RETURN_STATUS_IF_FALSE(env, flowControl.highWatermark == 0 ||
+        flowControl.lowWatermark < flowControl.highWatermark, napi_invalid_arg);
+
+    SWITCH_CONTEXT(env);
+    auto finalizeCallback = reinterpret_cast<NativeFinalize>(thread_finalize_cb);
+    auto callJsCallback = reinterpret_cast<NativeThreadSafeFunctionCallJs>(call_js_cb);
+    auto safeAsyncWork = engine->CreateSafeAsyncWork(func, async_resource, async_resource_name, max_queue_size,
+        initial_thread_count, thread_finalize_data, finalizeCallback, context, callJsCallback);
+    CHECK_ENV(safeAsyncWork);
+    safeAsyncWork->SetFlowControl(flowControl);
+
+    auto ret = safeAsyncWork->Init();
+    if (ret) {
+        *result = reinterpret_cast<napi_threadsafe_function>(safeAsyncWork);
+    } else {
+        return napi_status::napi_generic_failure;
+    }
+
+    return napi_status::napi_ok;
+}
+
+NAPI_EXTERN napi_status napi_get_threadsafe_function_queue_stats(
+    napi_threadsafe_function func, napi_threadsafe_function_queue_stats* stats)
+{
+    CHECK_ENV(func);
+    if (stats == nullptr) {
+        return napi_status::napi_invalid_arg;
+    }
+
+    auto safeAsyncWork = reinterpret_cast<NativeSafeAsyncWork*>(func);
+    NativeSafeAsyncQueueStats queueStats;
+    safeAsyncWork->GetQueueStats(queueStats);
+    stats->depth = queueStats.depth;
+    stats->peak_depth = queueStats.peakDepth;
+    stats->blocked_calls = queueStats.blockedCalls;
+    stats->blocked_time_us = queueStats.blockedTimeUs;
+    stats->timeouts = queueStats.timeouts;
+    return napi_status::napi_ok;
+}
+
+NAPI_EXTERN napi_status napi_get_async_work_pool_stats(napi_env env, napi_async_work_pool_stats* stats)
+{
+    CHECK_ENV(env);
+    CHECK_ARG(env, stats);
+
+    NativeAsyncWorkPoolStats poolStats;
+    reinterpret_cast<NativeEngine*>(env)->GetAsyncWorkPool().GetStats(poolStats);
+    stats->hits = poolStats.hits;
+    stats->misses = poolStats.misses;
+    stats->cached = poolStats.cached;
+    return napi_clear_last_error(env);
+}
+
+NAPI_EXTERN napi_status napi_set_async_work_pool_capacity(napi_env env, size_t capacity)
+{
+    CHECK_ENV(env);
+
+    reinterpret_cast<NativeEngine*>(env)->GetAsyncWorkPool().SetCapacity(capacity);
+    return napi_clear_last_error(env);
+}
+
+NAPI_EXTERN napi_status napi_get_reference_slab_stats(napi_env env, napi_reference_slab_stats* stats)
+{
+    CHECK_ENV(env);
+    CHECK_ARG(env, stats);
+
+    NativeSlabStats slabStats;
+    reinterpret_cast<ArkNativeEngine*>(env)->GetReferenceSlab()->GetStats(slabStats);
+    stats->chunks = slabStats.chunks;
+    stats->live_objects = slabStats.liveObjects;
+    stats->free_slots = slabStats.freeSlots;
+    stats->reserved_bytes = slabStats.reservedBytes;
+    stats->allocations = slabStats.allocations;
+    stats->frees = slabStats.frees;
+    return napi_clear_last_error(env);
+}
+
+NAPI_EXTERN napi_status napi_get_reference_stats(napi_env env, napi_reference_stats* stats)
+{
+    CHECK_ENV(env);
+    CHECK_ARG(env, stats);
+
+    NativeReferenceManager* referenceManager = reinterpret_cast<NativeEngine*>(env)->GetReferenceManager();
+    RETURN_STATUS_IF_FALSE(env, referenceManager != nullptr, napi_generic_failure);
+    NativeReferenceStats refStats;
+    referenceManager->GetStats(refStats);
+    constexpr auto none = static_cast<size_t>(NativeReferenceFinalizer::NONE);
+    constexpr auto sync = static_cast<size_t>(NativeReferenceFinalizer::SYNC);
+    constexpr auto async = static_cast<size_t>(NativeReferenceFinalizer::ASYNC);
+    stats->runtime_no_finalizer = refStats.runtimeOwned[none];
+    stats->runtime_sync_finalizer = refStats.runtimeOwned[sync];
+    stats->runtime_async_finalizer = refStats.runtimeOwned[async];
+    stats->user_no_finalizer = refStats.userOwned[none];
+    stats->user_sync_finalizer = refStats.userOwned[sync];
+    stats->user_async_finalizer = refStats.userOwned[async];
+    stats->tracked_capacity = refStats.capacity;
+    return napi_clear_last_error(env);
+}
+
+NAPI_EXTERN napi_status napi_request_async_work_cancel(napi_env env, napi_async_work work)
+{
+    CHECK_ENV(env);
+    CHECK_ARG(env, work);
+
+    auto asyncWork = reinterpret_cast<NativeAsyncWork*>(work);
+    RETURN_STATUS_IF_FALSE(env, asyncWork->RequestCancel(reinterpret_cast<NativeEngine*>(env)), napi_generic_failure);
+    return napi_clear_last_error(env);
+}
+
+NAPI_EXTERN napi_status napi_is_async_work_cancel_requested(napi_async_work work, bool* result)
+{
+    if (work == nullptr || result == nullptr) {
+        return napi_status::napi_invalid_arg;
+    }
+
+    *result = reinterpret_cast<NativeAsyncWork*>(work)->IsCancelRequested();
+    return napi_status::napi_ok;
+}
+
+NAPI_EXTERN napi_status napi_set_work_stealing_executor_enabled(napi_env env, bool enabled)
+{
+    CHECK_ENV(env);
+
+    auto engine = reinterpret_cast<NativeEngine*>(env);
+    NativeEngine* loopEngine = engine->IsMainEnvContext() ? engine : engine->GetParent();
+    RETURN_STATUS_IF_FALSE(env, loopEngine != nullptr && loopEngine->GetAsyncCompletionChannel() != nullptr,
+        napi_generic_failure);
+    loopEngine->SetAsyncExecutor(enabled ? NativeWorkStealingExecutor::GetInstance() : nullptr);
+    return napi_clear_last_error(env);
+}
+
+NAPI_EXTERN napi_status napi_set_task_latency_enabled(napi_env env, bool enabled)
+{
+    CHECK_ENV(env);
+
+    reinterpret_cast<NativeEngine*>(env)->GetTaskLatencyRecorder().SetEnabled(enabled);
+    return napi_clear_last_error(env);
+}
+
+NAPI_EXTERN napi_status napi_get_task_latency_stats(napi_env env,
+                                                    const char* name,
+                                                    napi_task_latency_phase phase,
+                                                    napi_task_latency_stats* stats)
+{
+    CHECK_ENV(env);
+    CHECK_ARG(env, name);
+    CHECK_ARG(env, stats);
+    RETURN_STATUS_IF_FALSE(env, phase >= napi_task_latency_queue_wait && phase <= napi_task_latency_call_js,
+        napi_invalid_arg);
+
+    NativeLatencyStats latency;
+    reinterpret_cast<NativeEngine*>(env)->GetTaskLatencyRecorder().GetStats(name,
+        static_cast<NativeLatencyPhase>(phase), latency);
+    stats->count = latency.count;
+    stats->total_us = latency.totalUs;
+    stats->max_us = latency.maxUs;
+    stats->p50_us = latency.p50Us;
+    stats->p90_us = latency.p90Us;
+    stats->p99_us = latency.p99Us;
+    return napi_clear_last_error(env);
+}
+
+// copies like napi_get_value_string_utf8, only the length is returned without buf
+static napi_status CopyDumpToBuffer(napi_env env, const std::string& dump, char* buf, size_t bufsize, size_t* result)
+{
+    if (buf == nullptr) {
+        *result = dump.size();
+    } else if (bufsize != 0) {
+        size_t copied = std::min(dump.size(), bufsize - 1);
+        if (memcpy_s(buf, bufsize, dump.data(), copied) != EOK) {
+            return napi_set_last_error(env, napi_generic_failure);
+        }
+        buf[copied] = '\0';
+        *result = copied;
+    } else {
+        *result = 0;
+    }
+    return napi_clear_last_error(env);
+}
+
+NAPI_EXTERN napi_status napi_dump_task_latency(napi_env env, char* buf, size_t bufsize, size_t* result)
+{
+    CHECK_ENV(env);
+    CHECK_ARG(env, result);
+
+    std::string json = reinterpret_cast<NativeEngine*>(env)->GetTaskLatencyRecorder().DumpJson();
+    return CopyDumpToBuffer(env, json, buf, bufsize, result);
+}
+
+NAPI_EXTERN napi_status napi_reset_task_latency(napi_env env)
+{
+    CHECK_ENV(env);
+
+    reinterpret_cast<NativeEngine*>(env)->GetTaskLatencyRecorder().Reset();
+    return napi_clear_last_error(env);
+}
+
+NAPI_EXTERN napi_status napi_get_finalizer_stats(napi_env env, napi_finalizer_stats* stats)
+{
+    CHECK_ENV(env);
+    CHECK_ARG(env, stats);
+
+    auto engine = reinterpret_cast<ArkNativeEngine*>(env);
+    // the finalizers of a context env are run by its root engine
+    if (!engine->IsMainEnvContext()) {
+        engine = const_cast<ArkNativeEngine*>(engine->GetParent());
+    }
+    stats->pending_finalizers = engine->GetPendingFinalizerCount();
+    stats->pending_native_binding_size = engine->GetPendingFinalizersNativeBindingSize();
+    NativeLatencyStats wait;
+    engine->GetFinalizerWaitHistogram().GetStats(wait);
+    stats->wait.count = wait.count;
+    stats->wait.total_us = wait.totalUs;
+    stats->wait.max_us = wait.maxUs;
+    stats->wait.p50_us = wait.p50Us;
+    stats->wait.p90_us = wait.p90Us;
+    stats->wait.p99_us = wait.p99Us;
+    return napi_clear_last_error(env);
+}
+
+NAPI_EXTERN napi_status napi_set_finalizer_profiling_enabled(napi_env env, bool enabled)
+{
+    CHECK_ENV(env);
+
+    NativeFinalizerProfiler::GetInstance().SetEnabled(enabled);
+    return napi_clear_last_error(env);
+}
+
+NAPI_EXTERN napi_status napi_dump_finalizer_profile(napi_env env,
+                                                    size_t top_n,
+                                                    char* buf,
+                                                    size_t bufsize,
+                                                    size_t* result)
+{
+    CHECK_ENV(env);
+    CHECK_ARG(env, result);
+
+    std::string json = NativeFinalizerProfiler::GetInstance().DumpJson(top_n);
+    return CopyDumpToBuffer(env, json, buf, bufsize, result);
+}
+
+NAPI_EXTERN napi_status napi_reset_finalizer_profile(napi_env env)
+{
+    CHECK_ENV(env);
+
+    NativeFinalizerProfiler::GetInstance().Reset();
+    return napi_clear_last_error(env);
+}
+
+NAPI_EXTERN napi_status napi_set_reference_sampling_interval(napi_env env, uint32_t interval)
+{
+    CHECK_ENV(env);
+
+    NativeReferenceSampler::GetInstance().SetInterval(interval);
+    return napi_clear_last_error(env);
+}
+
+NAPI_EXTERN napi_status napi_dump_reference_sites(napi_env env,
+                                                  size_t top_n,
+                                                  char* buf,
+                                                  size_t bufsize,
+                                                  size_t* result)
+{
+    CHECK_ENV(env);
+    CHECK_ARG(env, result);
+
+    std::string json = NativeReferenceSampler::GetInstance().DumpJson(top_n);
+    return CopyDumpToBuffer(env, json, buf, bufsize, result);
+}
+
+NAPI_EXTERN napi_status napi_set_direct_wrap_enabled(napi_env env, bool enabled)
+{
+    CHECK_ENV(env);
+
+    reinterpret_cast<NativeEngine*>(env)->SetDirectWrapEnabled(enabled);
+    return napi_clear_last_error(env);
+}
+
+NAPI_EXTERN napi_status napi_create_async_work_batch(napi_env env,
+                                                     napi_value async_resource_name,
+                                                     size_t count,
+                                                     napi_async_batch_execute_callback execute,
+                                                     napi_async_batch_complete_callback complete,
+                                                     void* data,
+                                                     bool report_item_status,
+                                                     napi_async_work_batch* result)
+{
+    CHECK_ENV(env);
+    CHECK_ARG(env, async_resource_name);
+    CHECK_ARG(env, execute);
+    CHECK_ARG(env, complete);
+    CHECK_ARG(env, result);
+    RETURN_STATUS_IF_FALSE(env, count > 0, napi_invalid_arg);
+
+    SWITCH_CONTEXT(env);
+    auto ecmaVm = engine->GetEcmaVm();
+    auto asyncResourceName = LocalValueFromJsValue(async_resource_name);
+    char name[64] = {0}; // 64:NAME_BUFFER_SIZE
+    if (!(asyncResourceName->IsNull() || asyncResourceName->IsUndefined())) {
+        panda::Local<panda::StringRef> nativeString(asyncResourceName);
+        int copied = nativeString->WriteUtf8(ecmaVm, name, 63, true) - 1;  // 63:NAME_BUFFER_SIZE
+        name[copied] = '\0';
+    }
+    auto batch = new NativeAsyncWorkBatch(engine, reinterpret_cast<NativeAsyncBatchExecuteCallback>(execute),
+        reinterpret_cast<NativeAsyncBatchCompleteCallback>(complete), name, count, data, report_item_status);
+    *result = reinterpret_cast<napi_async_work_batch>(batch);
+    return napi_clear_last_error(env);
+}
+
+NAPI_EXTERN napi_status napi_queue_async_work_batch(napi_env env, napi_async_work_batch batch, napi_qos_t qos)
+{
+    CHECK_ENV(env);
+    CHECK_ARG(env, batch);
+
+    auto asyncWorkBatch = reinterpret_cast<NativeAsyncWorkBatch*>(batch);
+    if (!asyncWorkBatch->Queue(reinterpret_cast<NativeEngine*>(env), qos)) {
+        return napi_set_last_error(env, napi_generic_failure);
+    }
+    return napi_clear_last_error(env);
+}
+
+NAPI_EXTERN napi_status napi_cancel_async_work_batch(napi_env env, napi_async_work_batch batch)
+{
+    CHECK_ENV(env);
+    CHECK_ARG(env, batch);
+
+    auto asyncWorkBatch = reinterpret_cast<NativeAsyncWorkBatch*>(batch);
+    if (!asyncWorkBatch->Cancel(reinterpret_cast<NativeEngine*>(env))) {
+        return napi_set_last_error(env, napi_generic_failure);
+    }
+    return napi_clear_last_error(env);
+}
+
+NAPI_EXTERN napi_status napi_delete_async_work_batch(napi_env env, napi_async_work_batch batch)
+{
+    CHECK_ENV(env);
+    CHECK_ARG(env, batch);
+
+    auto asyncWorkBatch = reinterpret_cast<NativeAsyncWorkBatch*>(batch);
+    // the runners hold their uv_work_t in the batch, it goes away once complete was called
+    if (asyncWorkBatch->IsInFlight()) {
+        HILOG_ERROR("async work batch is in flight, delete it from or after its complete callback");
+        return napi_set_last_error(env, napi_generic_failure);
+    }
+    delete asyncWorkBatch;
+    return napi_clear_last_error(env);
+}
+
+NAPI_EXTERN napi_status napi_call_threadsafe_function(
+    napi_threadsafe_function func, void* data, napi_threadsafe_function_call_mode is_blocking)
+{
+    CHECK_ENV(func);
+
+    auto safeAsyncWork = reinterpret_cast<NativeSafeAsyncWork*>(func);
+    auto callMode = static_cast<NativeThreadSafeFunctionCallMode>(is_blocking);
+
+    return SafeAsyncCodeToNapiStatus(safeAsyncWork->Send(data, callMode));
+}
+
+NAPI_EXTERN napi_status napi_call_threadsafe_function_batch(
+    napi_threadsafe_function func, void** items, size_t count, napi_threadsafe_function_call_mode is_blocking)
+{
+    CHECK_ENV(func);
+    if (items == nullptr || count == 0) {
+        return napi_status::napi_invalid_arg;
+    }
+
+    auto safeAsyncWork = reinterpret_cast<NativeSafeAsyncWork*>(func);
+    auto callMode = static_cast<NativeThreadSafeFunctionCallMode>(is_blocking);
+
+    return SafeAsyncCodeToNapiStatus(safeAsyncWork->SendBatch(items, count, callMode));
+}
+
+NAPI_EXTERN napi_status napi_set_threadsafe_function_drain_budget(
+    napi_threadsafe_function func, size_t max_items, uint64_t max_time_us)
+{
+    CHECK_ENV(func);
+
+    auto safeAsyncWork = reinterpret_cast<NativeSafeAsyncWork*>(func);
+    safeAsyncWork->SetDrainBudget(max_items, max_time_us);
+    return napi_status::napi_ok;
+}
+
+NAPI_EXTERN napi_status napi_set_default_threadsafe_function_drain_budget(
+    napi_env env, size_t max_items, uint64_t max_time_us)
+{
+    CHECK_ENV(env);
+
+    auto engine = reinterpret_cast<NativeEngine*>(env);
+    engine->SetTsfnDrainBudget(max_items, max_time_us);
+    return napi_clear_last_error(env);
+}
+
+NAPI_EXTERN napi_status napi_get_threadsafe_function_drain_stats(
+    napi_threadsafe_function func, uint64_t* deferred_drains, uint64_t* deferred_items)
+{
+    CHECK_ENV(func);
+    if (deferred_drains == nullptr || deferred_items == nullptr) {
+        return napi_status::napi_invalid_arg;
+    }
+
+    auto safeAsyncWork = reinterpret_cast<NativeSafeAsyncWork*>(func);
+    safeAsyncWork->GetDrainStats(*deferred_drains, *deferred_items);
+    return napi_status::napi_ok;
+}
+
 NAPI_EXTERN napi_status napi_acquire_threadsafe_function(napi_threadsafe_function func)
 {
     CHECK_ENV(func);
@@ -703,7 +1160,7 @@ NAPI_EXTERN napi_status napi_wrap_s(napi_env env,
     size_t nativeBindingSize = 0;
     auto reference = reinterpret_cast<NativeReference**>(result);
     Local<panda::StringRef> key = panda::StringRef::GetNapiWrapperString(vm);
-    if (nativeObject->Has(vm, key)) {
+    if (nativeObject->Has(vm, key) || IsObjectWrappedInPlace(vm, nativeObject)) {
         HILOG_ERROR("napi_wrap_s: current js_object has been wrapped.");
         return napi_set_last_error(env, napi_invalid_arg);
     }
@@ -784,7 +1241,7 @@ NAPI_EXTERN napi_status napi_wrap_enhance_s(napi_env env,
     CHECK_AND_CONVERT_TO_OBJECT(env, vm, nativeValue, nativeObject);
     auto reference = reinterpret_cast<NativeReference**>(result);
     Local<panda::StringRef> key = panda::StringRef::GetNapiWrapperString(vm);
-    if (nativeObject->Has(vm, key)) {
+    if (nativeObject->Has(vm, key) || IsObjectWrappedInPlace(vm, nativeObject)) {
         HILOG_ERROR("napi_wrap_enhance_s: current js_object has been wrapped.");
         return napi_set_last_error(env, napi_invalid_arg);
     }
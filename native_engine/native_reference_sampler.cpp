@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "native_reference_sampler.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#if !defined(WINDOWS_PLATFORM)
+#include <dlfcn.h>
+#include <unwind.h>
+#endif
+
+#include "native_json_writer.h"
+
+namespace {
+#if !defined(WINDOWS_PLATFORM)
+struct BacktraceState {
+    uintptr_t* frames = nullptr;
+    size_t count = 0;
+    size_t max = 0;
+    // the frame of the capturing function
+    size_t skip = 1;
+};
+
+_Unwind_Reason_Code CollectFrame(struct _Unwind_Context* context, void* arg)
+{
+    auto state = static_cast<BacktraceState*>(arg);
+    uintptr_t pc = _Unwind_GetIP(context);
+    if (pc == 0) {
+        return _URC_END_OF_STACK;
+    }
+    if (state->skip > 0) {
+        state->skip--;
+        return _URC_NO_REASON;
+    }
+    state->frames[state->count++] = pc;
+    return state->count < state->max ? _URC_NO_REASON : _URC_END_OF_STACK;
+}
+#endif
+
+size_t CaptureNativeStack(uintptr_t* frames, size_t max)
+{
+#if !defined(WINDOWS_PLATFORM)
+    BacktraceState state;
+    state.frames = frames;
+    state.max = max;
+    _Unwind_Backtrace(CollectFrame, &state);
+    return state.count;
+#else
+    return 0;
+#endif
+}
+
+// module!symbol+offset, or module+offset from the module base when the symbol is not exported
+std::string ResolveFrame(uintptr_t pc)
+{
+    char text[32] = { 0 };
+#if !defined(WINDOWS_PLATFORM)
+    Dl_info info;
+    if (dladdr(reinterpret_cast<void*>(pc), &info) != 0 && info.dli_fname != nullptr) {
+        std::string frame = info.dli_fname;
+        if (info.dli_sname != nullptr) {
+            snprintf(text, sizeof(text), "+0x%" PRIxPTR, pc - reinterpret_cast<uintptr_t>(info.dli_saddr));
+            return frame + '!' + info.dli_sname + text;
+        }
+        snprintf(text, sizeof(text), "+0x%" PRIxPTR, pc - reinterpret_cast<uintptr_t>(info.dli_fbase));
+        return frame + text;
+    }
+#endif
+    snprintf(text, sizeof(text), "0x%" PRIxPTR, pc);
+    return text;
+}
+} // namespace
+
+NativeReferenceSampler& NativeReferenceSampler::GetInstance()
+{
+    static NativeReferenceSampler instance;
+    return instance;
+}
+
+bool NativeReferenceSampler::Tick(uint32_t interval)
+{
+    thread_local uint32_t countdown = 0;
+    if (countdown == 0 || countdown > interval) {
+        countdown = interval;
+    }
+    return --countdown == 0;
+}
+
+uint32_t NativeReferenceSampler::Record(const std::string& jsStack)
+{
+    uintptr_t frames[MAX_NATIVE_FRAMES];
+    size_t count = CaptureNativeStack(frames, MAX_NATIVE_FRAMES);
+    std::string key(reinterpret_cast<const char*>(frames), count * sizeof(uintptr_t));
+    key += jsStack;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = siteIndex_.find(key);
+    if (iter == siteIndex_.end()) {
+        if (sites_.size() >= MAX_SITES) {
+            dropped_++;
+            return 0;
+        }
+        Site site;
+        site.frames.assign(frames, frames + count);
+        site.jsStack = jsStack;
+        sites_.emplace_back(std::move(site));
+        iter = siteIndex_.emplace(std::move(key), static_cast<uint32_t>(sites_.size())).first;
+    }
+    Site& site = sites_[iter->second - 1];
+    site.live++;
+    site.total++;
+    return iter->second;
+}
+
+void NativeReferenceSampler::Release(uint32_t site)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (site == 0 || site > sites_.size() || sites_[site - 1].live == 0) {
+        return;
+    }
+    sites_[site - 1].live--;
+}
+
+std::string NativeReferenceSampler::DumpJson(size_t topN) const
+{
+    std::vector<Site> sites;
+    uint64_t dropped = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        sites.reserve(sites_.size());
+        for (const auto& site : sites_) {
+            if (site.live != 0) {
+                sites.push_back(site);
+            }
+        }
+        dropped = dropped_;
+    }
+    size_t count = std::min(topN, sites.size());
+    std::partial_sort(sites.begin(), sites.begin() + count, sites.end(),
+        [](const Site& a, const Site& b) { return a.live > b.live; });
+    sites.resize(count);
+
+    // dladdr takes the loader lock, so it is left out of mutex_
+    std::string out = "{";
+    NativeJsonWriter::AppendNumber(out, "interval", GetInterval());
+    out += ',';
+    NativeJsonWriter::AppendNumber(out, "dropped", dropped);
+    out += ",\"sites\":[";
+    for (size_t i = 0; i < sites.size(); ++i) {
+        const auto& site = sites[i];
+        if (i != 0) {
+            out += ',';
+        }
+        out += '{';
+        NativeJsonWriter::AppendNumber(out, "live", site.live);
+        out += ',';
+        NativeJsonWriter::AppendNumber(out, "total", site.total);
+        out += ",\"nativeStack\":[";
+        for (size_t j = 0; j < site.frames.size(); ++j) {
+            if (j != 0) {
+                out += ',';
+            }
+            NativeJsonWriter::AppendString(out, ResolveFrame(site.frames[j]));
+        }
+        out += "],\"jsStack\":";
+        NativeJsonWriter::AppendString(out, site.jsStack);
+        out += '}';
+    }
+    out += "]}";
+    return out;
+}
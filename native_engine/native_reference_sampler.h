@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_NAPI_NATIVE_ENGINE_NATIVE_REFERENCE_SAMPLER_H
+#define FOUNDATION_ACE_NAPI_NATIVE_ENGINE_NATIVE_REFERENCE_SAMPLER_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/*
+ * Process wide allocation sites of sampled references, the ones napi_wrap creates included, to find leaks.
+ * Every interval-th reference created on a thread records the native stack, plus the js stack on the js thread of its
+ * engine, and counts live at that site until it is deleted or its object is collected. Sampling is off by default,
+ * then creating a reference only loads the interval, while on the references which are not sampled only count down a
+ * thread local. Native frames are resolved when dumped. Sites beyond MAX_SITES are counted as dropped.
+ */
+class NativeReferenceSampler {
+public:
+    static constexpr size_t MAX_SITES = 1024;
+    static constexpr size_t MAX_NATIVE_FRAMES = 16;
+
+    NativeReferenceSampler(const NativeReferenceSampler&) = delete;
+    NativeReferenceSampler& operator=(const NativeReferenceSampler&) = delete;
+
+    static NativeReferenceSampler& GetInstance();
+
+    // 0 turns sampling off, the live counts of the sites keep going down
+    void SetInterval(uint32_t interval)
+    {
+        interval_.store(interval, std::memory_order_relaxed);
+    }
+
+    uint32_t GetInterval() const
+    {
+        return interval_.load(std::memory_order_relaxed);
+    }
+
+    bool ShouldSample()
+    {
+        uint32_t interval = interval_.load(std::memory_order_relaxed);
+        return interval != 0 && Tick(interval);
+    }
+
+    // returns the site id to release the reference with, 0 when the site was dropped
+    uint32_t Record(const std::string& jsStack);
+    void Release(uint32_t site);
+    // the topN sites with the most live references
+    std::string DumpJson(size_t topN) const;
+
+private:
+    struct Site {
+        std::vector<uintptr_t> frames;
+        std::string jsStack;
+        uint64_t live = 0;
+        uint64_t total = 0;
+    };
+
+    NativeReferenceSampler() = default;
+    ~NativeReferenceSampler() = default;
+
+    static bool Tick(uint32_t interval);
+
+    std::atomic<uint32_t> interval_ { 0 };
+    mutable std::mutex mutex_;
+    std::vector<Site> sites_;
+    // native frames and js stack of a site to its index
+    std::unordered_map<std::string, uint32_t> siteIndex_;
+    uint64_t dropped_ = 0;
+};
+
+#endif /* FOUNDATION_ACE_NAPI_NATIVE_ENGINE_NATIVE_REFERENCE_SAMPLER_H */
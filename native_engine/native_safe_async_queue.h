@@ -0,0 +1,351 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_NAPI_NATIVE_ENGINE_NATIVE_SAFE_ASYNC_QUEUE_H
+#define FOUNDATION_ACE_NAPI_NATIVE_ENGINE_NATIVE_SAFE_ASYNC_QUEUE_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+
+/*
+ * Bounded lock-free multi-producer/single-consumer ring.
+ * Every cell carries a sequence number, producers claim a slot with one CAS on the enqueue position and publish it
+ * by storing the next sequence; the consumer is the only thread that advances the dequeue position.
+ */
+class NativeSafeAsyncRing {
+public:
+    explicit NativeSafeAsyncRing(size_t capacity)
+    {
+        size_t realCapacity = MIN_CAPACITY;
+        while (realCapacity < capacity) {
+            realCapacity <<= 1;
+        }
+        mask_ = realCapacity - 1;
+        cells_ = std::make_unique<Cell[]>(realCapacity);
+        for (size_t i = 0; i < realCapacity; ++i) {
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+    ~NativeSafeAsyncRing() = default;
+
+    NativeSafeAsyncRing(const NativeSafeAsyncRing&) = delete;
+    NativeSafeAsyncRing& operator=(const NativeSafeAsyncRing&) = delete;
+
+    // can be called by any thread, returns false when the ring is full
+    bool TryPush(void* data)
+    {
+        return TryPushBatch(&data, 1);
+    }
+
+    // claims count contiguous cells with a single CAS, returns false when they are not all free
+    bool TryPushBatch(void* const* items, size_t count)
+    {
+        if (count == 0 || count > Capacity()) {
+            return false;
+        }
+        size_t pos = enqueuePos_.load(std::memory_order_relaxed);
+        for (;;) {
+            // the consumer frees cells in order, so the last cell being free means the whole span is free
+            size_t lastPos = pos + count - 1;
+            size_t seq = cells_[lastPos & mask_].sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(lastPos);
+            if (diff == 0) {
+                if (enqueuePos_.compare_exchange_weak(pos, pos + count, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = enqueuePos_.load(std::memory_order_relaxed);
+            }
+        }
+        for (size_t i = 0; i < count; ++i) {
+            Cell* cell = &cells_[(pos + i) & mask_];
+            cell->data = items[i];
+            cell->sequence.store(pos + i + 1, std::memory_order_release);
+        }
+        return true;
+    }
+
+    // consumer thread only, true when no cell was claimed past the dequeue position, published or not
+    bool IsDrained() const
+    {
+        return enqueuePos_.load(std::memory_order_acquire) == dequeuePos_;
+    }
+
+    // must only be called by the consumer thread, returns false when no published cell is available
+    bool TryPop(void*& data)
+    {
+        Cell* cell = &cells_[dequeuePos_ & mask_];
+        size_t seq = cell->sequence.load(std::memory_order_acquire);
+        if (static_cast<intptr_t>(seq) - static_cast<intptr_t>(dequeuePos_ + 1) < 0) {
+            return false;
+        }
+        data = cell->data;
+        cell->sequence.store(dequeuePos_ + mask_ + 1, std::memory_order_release);
+        ++dequeuePos_;
+        return true;
+    }
+
+    size_t Capacity() const
+    {
+        return mask_ + 1;
+    }
+
+private:
+    static constexpr size_t MIN_CAPACITY = 2;
+    static constexpr size_t CACHE_LINE_SIZE = 64;
+
+    struct Cell {
+        std::atomic<size_t> sequence { 0 };
+        void* data { nullptr };
+    };
+
+    std::unique_ptr<Cell[]> cells_ {};
+    size_t mask_ { 0 };
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> enqueuePos_ { 0 };
+    alignas(CACHE_LINE_SIZE) size_t dequeuePos_ { 0 };
+};
+
+/*
+ * Queue used by NativeSafeAsyncWork between producer threads and the js thread.
+ * The fast path is the lock-free ring, a mutex guarded deque only takes the items the ring can not hold, and once
+ * it is non-empty producers keep appending to it until the consumer drained it so per-producer order is kept.
+ * Size accounting is done at admission time which makes the max queue size check exact under contention.
+ */
+class NativeSafeAsyncQueue {
+public:
+    explicit NativeSafeAsyncQueue(size_t maxQueueSize)
+        : ring_(maxQueueSize > 0 && maxQueueSize < MAX_RING_CAPACITY ? maxQueueSize + 1 : MAX_RING_CAPACITY)
+    {}
+    ~NativeSafeAsyncQueue() = default;
+
+    NativeSafeAsyncQueue(const NativeSafeAsyncQueue&) = delete;
+    NativeSafeAsyncQueue& operator=(const NativeSafeAsyncQueue&) = delete;
+
+    // the queue is treated as full when it already holds more than maxQueueSize items, 0 means unlimited
+    bool TryPush(void* data, size_t maxQueueSize)
+    {
+        return TryPushBatch(&data, 1, maxQueueSize);
+    }
+
+    // the whole span is admitted or rejected at once and stays contiguous in the queue
+    bool TryPushBatch(void* const* items, size_t count, size_t maxQueueSize)
+    {
+        if (!Reserve(maxQueueSize, count)) {
+            return false;
+        }
+        if (overflowSize_.load(std::memory_order_acquire) == 0 && ring_.TryPushBatch(items, count)) {
+            return true;
+        }
+        std::lock_guard<std::mutex> lock(overflowMutex_);
+        if (overflow_.empty() && ring_.TryPushBatch(items, count)) {
+            return true;
+        }
+        overflow_.insert(overflow_.end(), items, items + count);
+        overflowSize_.fetch_add(count, std::memory_order_release);
+        return true;
+    }
+
+    // consumer thread only
+    bool TryPop(void*& data)
+    {
+        if (!ring_.TryPop(data)) {
+            // a claimed cell which is not published yet holds an item older than the overflow, wait for it
+            if (overflowSize_.load(std::memory_order_acquire) == 0 || !ring_.IsDrained()) {
+                return false;
+            }
+            std::lock_guard<std::mutex> lock(overflowMutex_);
+            if (overflow_.empty()) {
+                return false;
+            }
+            data = overflow_.front();
+            overflow_.pop_front();
+            overflowSize_.fetch_sub(1, std::memory_order_release);
+        }
+        size_.fetch_sub(1, std::memory_order_seq_cst);
+        return true;
+    }
+
+    size_t Size() const
+    {
+        return size_.load(std::memory_order_seq_cst);
+    }
+
+    bool Empty() const
+    {
+        return Size() == 0;
+    }
+
+private:
+    static constexpr size_t MAX_RING_CAPACITY = 1024;
+
+    bool Reserve(size_t maxQueueSize, size_t count)
+    {
+        if (maxQueueSize == 0) {
+            size_.fetch_add(count, std::memory_order_seq_cst);
+            return true;
+        }
+        size_t current = size_.load(std::memory_order_seq_cst);
+        do {
+            if (current + count > maxQueueSize + 1) {
+                return false;
+            }
+        } while (!size_.compare_exchange_weak(current, current + count, std::memory_order_seq_cst));
+        return true;
+    }
+
+    NativeSafeAsyncRing ring_;
+    std::atomic<size_t> size_ { 0 };
+    std::atomic<size_t> overflowSize_ { 0 };
+    std::mutex overflowMutex_;
+    std::deque<void*> overflow_;
+};
+
+enum class SafeAsyncLane : size_t {
+    IMMEDIATE = 0,
+    HIGH,
+    LOW,
+    IDLE,
+};
+
+/*
+ * Multi-level queue of NativeSafeAsyncWork, lanes follow napi_task_priority.
+ * Plain sends are the tail of the low lane and stay on the lock-free NativeSafeAsyncQueue, prioritized and head
+ * inserted items go to small mutex guarded deques which are only allocated once used.
+ * The consumer serves the highest non-empty lane, a lane skipped STARVATION_LIMIT times in a row while it had
+ * items is served first so low and idle items still make progress under a stream of urgent ones.
+ */
+class NativeSafeAsyncLaneQueue {
+public:
+    static constexpr size_t LANE_COUNT = 4;
+    static constexpr size_t STARVATION_LIMIT = 32;
+
+    explicit NativeSafeAsyncLaneQueue(size_t maxQueueSize) : tail_(maxQueueSize) {}
+    ~NativeSafeAsyncLaneQueue() = default;
+
+    NativeSafeAsyncLaneQueue(const NativeSafeAsyncLaneQueue&) = delete;
+    NativeSafeAsyncLaneQueue& operator=(const NativeSafeAsyncLaneQueue&) = delete;
+
+    bool TryPush(void* data, size_t maxQueueSize)
+    {
+        return tail_.TryPush(data, maxQueueSize);
+    }
+
+    bool TryPushBatch(void* const* items, size_t count, size_t maxQueueSize)
+    {
+        return tail_.TryPushBatch(items, count, maxQueueSize);
+    }
+
+    // prioritized items are not limited by the max queue size, like the event handler path they replace
+    void Push(void* data, SafeAsyncLane lane, bool isTail)
+    {
+        size_t index = static_cast<size_t>(lane);
+        if (lane == SafeAsyncLane::LOW && isTail) {
+            tail_.TryPush(data, 0);
+            return;
+        }
+        std::lock_guard<std::mutex> lock(laneMutex_);
+        if (lanes_ == nullptr) {
+            lanes_ = std::make_unique<std::array<std::deque<void*>, LANE_COUNT>>();
+        }
+        auto& queue = (*lanes_)[index];
+        if (isTail) {
+            queue.push_back(data);
+        } else {
+            queue.push_front(data);
+        }
+        laneSizes_[index].fetch_add(1, std::memory_order_release);
+        laneTotal_.fetch_add(1, std::memory_order_seq_cst);
+    }
+
+    // consumer thread only
+    bool TryPop(void*& data)
+    {
+        for (size_t index = 0; index < LANE_COUNT; ++index) {
+            if (skipped_[index] >= STARVATION_LIMIT && PopFromLane(index, data)) {
+                MarkServed(index);
+                return true;
+            }
+        }
+        for (size_t index = 0; index < LANE_COUNT; ++index) {
+            if (PopFromLane(index, data)) {
+                MarkServed(index);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    size_t Size() const
+    {
+        return tail_.Size() + laneTotal_.load(std::memory_order_seq_cst);
+    }
+
+    bool Empty() const
+    {
+        return Size() == 0;
+    }
+
+private:
+    bool HasItems(size_t index) const
+    {
+        return laneSizes_[index].load(std::memory_order_acquire) > 0 ||
+               (index == static_cast<size_t>(SafeAsyncLane::LOW) && !tail_.Empty());
+    }
+
+    bool PopFromLane(size_t index, void*& data)
+    {
+        if (laneSizes_[index].load(std::memory_order_acquire) > 0) {
+            std::lock_guard<std::mutex> lock(laneMutex_);
+            auto& queue = (*lanes_)[index];
+            if (!queue.empty()) {
+                data = queue.front();
+                queue.pop_front();
+                laneSizes_[index].fetch_sub(1, std::memory_order_release);
+                laneTotal_.fetch_sub(1, std::memory_order_seq_cst);
+                return true;
+            }
+        }
+        // head inserted low items go before the plain sends
+        return index == static_cast<size_t>(SafeAsyncLane::LOW) && tail_.TryPop(data);
+    }
+
+    void MarkServed(size_t served)
+    {
+        for (size_t index = 0; index < LANE_COUNT; ++index) {
+            if (index == served) {
+                skipped_[index] = 0;
+            } else if (HasItems(index)) {
+                skipped_[index]++;
+            }
+        }
+    }
+
+    NativeSafeAsyncQueue tail_;
+    std::mutex laneMutex_;
+    std::unique_ptr<std::array<std::deque<void*>, LANE_COUNT>> lanes_;
+    std::array<std::atomic<size_t>, LANE_COUNT> laneSizes_ {};
+    std::atomic<size_t> laneTotal_ { 0 };
+    // consumer thread only
+    std::array<size_t, LANE_COUNT> skipped_ {};
+};
+
+#endif /* FOUNDATION_ACE_NAPI_NATIVE_ENGINE_NATIVE_SAFE_ASYNC_QUEUE_H */
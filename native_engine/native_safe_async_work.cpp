@@ -14,6 +14,7 @@
  */
 
 #include <cinttypes>
+#include <thread>
 
 #include "native_safe_async_work.h"
 
@@ -41,6 +42,59 @@ constexpr size_t TRACEID_PARAM_SIZE = 10;
 using namespace OHOS::HiviewDFX;
 #endif
 
+// keeps the work alive for CleanUp while a producer is between its status check and uv_async_send
+class InflightProducerScope {
+public:
+    explicit InflightProducerScope(std::atomic<size_t>& counter) : counter_(counter)
+    {
+        counter_.fetch_add(1, std::memory_order_seq_cst);
+    }
+    ~InflightProducerScope()
+    {
+        counter_.fetch_sub(1, std::memory_order_release);
+    }
+
+private:
+    std::atomic<size_t>& counter_;
+};
+
+// wraps the items of a send when latency recording is on, the wrappers are freed again unless they were queued
+class TimedItemsScope {
+public:
+    TimedItemsScope(bool recordLatency, void* const* items, size_t count) : items_(items)
+    {
+        if (!recordLatency) {
+            return;
+        }
+        uint64_t now = NativeTaskLatencyRecorder::Now();
+        timedItems_.reserve(count);
+        for (size_t i = 0; i < count; ++i) {
+            timedItems_.push_back(new NativeSafeAsyncTimedItem { items[i], now });
+        }
+        items_ = timedItems_.data();
+    }
+    ~TimedItemsScope()
+    {
+        for (auto item : timedItems_) {
+            delete reinterpret_cast<NativeSafeAsyncTimedItem*>(item);
+        }
+    }
+
+    void* const* Get() const
+    {
+        return items_;
+    }
+
+    void Commit()
+    {
+        timedItems_.clear();
+    }
+
+private:
+    void* const* items_;
+    std::vector<void*> timedItems_;
+};
+
 // static methods start
 void NativeSafeAsyncWork::AsyncCallback(uv_async_t* asyncHandler)
 {
@@ -84,7 +138,7 @@ NativeSafeAsyncWork::NativeSafeAsyncWork(NativeEngine* engine,
                                          NativeThreadSafeFunctionCallJs callJsCallback)
     :engine_(engine), engineId_(engine->GetId()), maxQueueSize_(maxQueueSize),
     threadCount_(threadCount), finalizeData_(finalizeData), finalizeCallback_(finalizeCallback),
-    context_(context), callJsCallback_(callJsCallback)
+    context_(context), callJsCallback_(callJsCallback), queue_(maxQueueSize)
 {
     asyncContext_.napiAsyncResource = asyncResource;
     asyncContext_.napiAsyncResourceName = asyncResourceName;
@@ -114,6 +168,18 @@ NativeSafeAsyncWork::NativeSafeAsyncWork(NativeEngine* engine,
     }
 #endif
 
+    if (engine->GetTaskLatencyRecorder().IsEnabled()) {
+        recordLatency_ = true;
+        if (asyncResourceName != nullptr) {
+            auto vm = engine->GetEcmaVm();
+            panda::LocalScope scope(vm);
+            latencyName_ = LocalValueFromJsValue(asyncResourceName)->ToString(vm)->ToString(vm);
+        }
+    }
+
+    drainItemBudget_.store(engine->GetTsfnDrainItemBudget(), std::memory_order_relaxed);
+    drainTimeBudgetUs_.store(engine->GetTsfnDrainTimeBudget(), std::memory_order_relaxed);
+
     InitSafeAsyncWorkTraceId();
 }
 
@@ -155,12 +221,11 @@ bool NativeSafeAsyncWork::Init()
     return true;
 }
 
-bool NativeSafeAsyncWork::IsMaxQueueSize()
+bool NativeSafeAsyncWork::IsClosingOrClosed() const
 {
-    return (queue_.size() > maxQueueSize_ &&
-           maxQueueSize_ > 0 &&
-           status_ != SafeAsyncStatus::SAFE_ASYNC_STATUS_CLOSING &&
-           status_ != SafeAsyncStatus::SAFE_ASYNC_STATUS_CLOSED);
+    SafeAsyncStatus status = status_.load(std::memory_order_seq_cst);
+    return status == SafeAsyncStatus::SAFE_ASYNC_STATUS_CLOSING ||
+           status == SafeAsyncStatus::SAFE_ASYNC_STATUS_CLOSED;
 }
 
 SafeAsyncCode NativeSafeAsyncWork::ValidEngineCheck()
@@ -180,42 +245,194 @@ SafeAsyncCode NativeSafeAsyncWork::ValidEngineCheck()
 
 SafeAsyncCode NativeSafeAsyncWork::Send(void* data, NativeThreadSafeFunctionCallMode mode)
 {
-    std::unique_lock<std::mutex> lock(mutex_);
-    if (IsMaxQueueSize()) {
-        HILOG_INFO("queue size bigger than max queue size");
-        if (mode == NATIVE_TSFUNC_BLOCKING) {
-            while (IsMaxQueueSize()) {
-                condition_.wait(lock);
-            }
-        } else {
-            return SafeAsyncCode::SAFE_ASYNC_QUEUE_FULL;
-        }
+    return SendBatch(&data, 1, mode);
+}
+
+SafeAsyncCode NativeSafeAsyncWork::SendBatch(void* const* items, size_t count, NativeThreadSafeFunctionCallMode mode)
+{
+    if (items == nullptr || count == 0) {
+        return SafeAsyncCode::SAFE_ASYNC_INVALID_ARGS;
+    }
+    // the batch is admitted as a whole, one that can never fit would block forever
+    if (maxQueueSize_ > 0 && count > maxQueueSize_) {
+        HILOG_ERROR("batch size %{public}zu exceeds max queue size %{public}zu", count, maxQueueSize_);
+        return SafeAsyncCode::SAFE_ASYNC_INVALID_ARGS;
     }
 
-    if (status_ == SafeAsyncStatus::SAFE_ASYNC_STATUS_CLOSED ||
-        status_ == SafeAsyncStatus::SAFE_ASYNC_STATUS_CLOSING) {
-        if (threadCount_ == 0) {
-            return SafeAsyncCode::SAFE_ASYNC_INVALID_ARGS;
-        } else {
-            threadCount_--;
-            return SafeAsyncCode::SAFE_ASYNC_CLOSED;
-        }
-    } else {
+    InflightProducerScope producerScope(inflightProducers_);
+    if (!IsClosingOrClosed()) {
         SafeAsyncCode checkRet = ValidEngineCheck();
         if (checkRet != SafeAsyncCode::SAFE_ASYNC_OK) {
             return checkRet;
         }
-        queue_.emplace_back(data);
+        TimedItemsScope timedItems(recordLatency_, items, count);
+        if (!queue_.TryPushBatch(timedItems.Get(), count, maxQueueSize_)) {
+            HILOG_INFO("queue size bigger than max queue size");
+            if (mode != NATIVE_TSFUNC_BLOCKING) {
+                return SafeAsyncCode::SAFE_ASYNC_QUEUE_FULL;
+            }
+            SafeAsyncCode waitRet = WaitForQueueSpace(timedItems.Get(), count);
+            if (waitRet != SafeAsyncCode::SAFE_ASYNC_OK) {
+                return waitRet;
+            }
+        }
+        timedItems.Commit();
+        OnItemsQueued();
+        // one wakeup for the whole batch
         auto ret = uv_async_send(&asyncHandler_);
         if (ret != 0) {
             HILOG_ERROR("uv async send failed in Send ret = %{public}d", ret);
             return SafeAsyncCode::SAFE_ASYNC_FAILED;
         }
+        return SafeAsyncCode::SAFE_ASYNC_OK;
+    }
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    return ReleaseThreadOnClosed();
+}
+
+SafeAsyncCode NativeSafeAsyncWork::ReleaseThreadOnClosed()
+{
+    if (threadCount_ == 0) {
+        return SafeAsyncCode::SAFE_ASYNC_INVALID_ARGS;
     }
+    threadCount_--;
+    return SafeAsyncCode::SAFE_ASYNC_CLOSED;
+}
 
+SafeAsyncCode NativeSafeAsyncWork::SendToLane(void* data, SafeAsyncLane lane, bool isTail, bool releaseThread)
+{
+    if (static_cast<size_t>(lane) >= NativeSafeAsyncLaneQueue::LANE_COUNT) {
+        HILOG_ERROR("invalid lane %{public}zu", static_cast<size_t>(lane));
+        return SafeAsyncCode::SAFE_ASYNC_INVALID_ARGS;
+    }
+
+    InflightProducerScope producerScope(inflightProducers_);
+    if (IsClosingOrClosed()) {
+        HILOG_WARN("Do not send, thread is closed!");
+        if (!releaseThread) {
+            return SafeAsyncCode::SAFE_ASYNC_CLOSED;
+        }
+        std::unique_lock<std::mutex> lock(mutex_);
+        return ReleaseThreadOnClosed();
+    }
+    SafeAsyncCode checkRet = ValidEngineCheck();
+    if (checkRet != SafeAsyncCode::SAFE_ASYNC_OK) {
+        return checkRet;
+    }
+    TimedItemsScope timedItems(recordLatency_, &data, 1);
+    queue_.Push(*timedItems.Get(), lane, isTail);
+    timedItems.Commit();
+    OnItemsQueued();
+    auto ret = uv_async_send(&asyncHandler_);
+    if (ret != 0) {
+        HILOG_ERROR("uv async send failed in SendToLane ret = %{public}d", ret);
+        return SafeAsyncCode::SAFE_ASYNC_FAILED;
+    }
     return SafeAsyncCode::SAFE_ASYNC_OK;
 }
 
+SafeAsyncCode NativeSafeAsyncWork::WaitForQueueSpace(void* const* items, size_t count)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    bool pushed = false;
+    bool ready = true;
+    auto begin = std::chrono::steady_clock::now();
+    auto tryPush = [this, items, count, &pushed] {
+        pushed = queue_.TryPushBatch(items, count, maxQueueSize_);
+        return pushed || IsClosingOrClosed();
+    };
+    blockedProducers_.fetch_add(1, std::memory_order_seq_cst);
+    if (flowControl_.blockingTimeoutMs == 0) {
+        condition_.wait(lock, tryPush);
+    } else {
+        ready = condition_.wait_for(lock, std::chrono::milliseconds(flowControl_.blockingTimeoutMs), tryPush);
+    }
+    blockedProducers_.fetch_sub(1, std::memory_order_seq_cst);
+    auto blockedTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - begin);
+    blockedCalls_.fetch_add(1, std::memory_order_relaxed);
+    blockedTimeUs_.fetch_add(static_cast<uint64_t>(blockedTime.count()), std::memory_order_relaxed);
+    if (pushed) {
+        return SafeAsyncCode::SAFE_ASYNC_OK;
+    }
+    if (!ready) {
+        HILOG_INFO("blocking send timed out after %{public}" PRIu64 "ms", flowControl_.blockingTimeoutMs);
+        timeouts_.fetch_add(1, std::memory_order_relaxed);
+        return SafeAsyncCode::SAFE_ASYNC_QUEUE_FULL;
+    }
+    return ReleaseThreadOnClosed();
+}
+
+void NativeSafeAsyncWork::OnItemsQueued()
+{
+    size_t depth = queue_.Size();
+    size_t peak = peakDepth_.load(std::memory_order_relaxed);
+    while (depth > peak) {
+        if (peakDepth_.compare_exchange_weak(peak, depth, std::memory_order_relaxed)) {
+            break;
+        }
+    }
+    // called on the producer thread which pushed the queue over the high watermark
+    if (flowControl_.highWatermark > 0 && depth >= flowControl_.highWatermark &&
+        !aboveHighWatermark_.exchange(true, std::memory_order_acq_rel) && flowControl_.watermarkCallback != nullptr) {
+        flowControl_.watermarkCallback(this, context_, depth, true);
+    }
+}
+
+void NativeSafeAsyncWork::OnItemsDrained()
+{
+    // called on the js thread once a wakeup drained the queue down to the low watermark
+    if (flowControl_.highWatermark == 0 || !aboveHighWatermark_.load(std::memory_order_acquire)) {
+        return;
+    }
+    size_t depth = queue_.Size();
+    if (depth <= flowControl_.lowWatermark && aboveHighWatermark_.exchange(false, std::memory_order_acq_rel) &&
+        flowControl_.watermarkCallback != nullptr) {
+        flowControl_.watermarkCallback(this, context_, depth, false);
+    }
+}
+
+bool NativeSafeAsyncWork::SetFlowControl(const NativeSafeAsyncFlowControl& flowControl)
+{
+    if (flowControl.highWatermark > 0 && flowControl.lowWatermark >= flowControl.highWatermark) {
+        HILOG_ERROR("low watermark %{public}zu must be below high watermark %{public}zu",
+                    flowControl.lowWatermark, flowControl.highWatermark);
+        return false;
+    }
+    flowControl_ = flowControl;
+    return true;
+}
+
+void NativeSafeAsyncWork::GetQueueStats(NativeSafeAsyncQueueStats& stats) const
+{
+    stats.depth = queue_.Size();
+    stats.peakDepth = peakDepth_.load(std::memory_order_relaxed);
+    stats.blockedCalls = blockedCalls_.load(std::memory_order_relaxed);
+    stats.blockedTimeUs = blockedTimeUs_.load(std::memory_order_relaxed);
+    stats.timeouts = timeouts_.load(std::memory_order_relaxed);
+}
+
+void NativeSafeAsyncWork::NotifyBlockedProducer(size_t freed)
+{
+    // pairs with the increment in WaitForQueueSpace, both sides use seq_cst so one of them observes the other
+    if (freed > 0 && blockedProducers_.load(std::memory_order_seq_cst) > 0) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        // several slots may satisfy several waiters, and a waiting batch may need more than one slot
+        if (freed > 1) {
+            condition_.notify_all();
+        } else {
+            condition_.notify_one();
+        }
+    }
+}
+
+void NativeSafeAsyncWork::WaitForInflightProducers()
+{
+    while (inflightProducers_.load(std::memory_order_acquire) != 0) {
+        std::this_thread::yield();
+    }
+}
+
 SafeAsyncCode NativeSafeAsyncWork::Acquire()
 {
     std::unique_lock<std::mutex> lock(mutex_);
@@ -255,7 +472,7 @@ SafeAsyncCode NativeSafeAsyncWork::Release(NativeThreadSafeFunctionReleaseMode m
     if (mode == NativeThreadSafeFunctionReleaseMode::NATIVE_TSFUNC_ABORT) {
         status_ = SafeAsyncStatus::SAFE_ASYNC_STATUS_CLOSING;
         if (maxQueueSize_ > 0) {
-            condition_.notify_one();
+            condition_.notify_all();
         }
     }
 
@@ -307,19 +524,24 @@ void* NativeSafeAsyncWork::GetContext()
 
 void NativeSafeAsyncWork::ProcessAsyncHandle()
 {
-    std::unique_lock<std::mutex> lock(mutex_);
-    if (status_ == SafeAsyncStatus::SAFE_ASYNC_STATUS_CLOSED) {
-        HILOG_ERROR("Process failed, thread is closed!");
-        return;
-    }
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (status_ == SafeAsyncStatus::SAFE_ASYNC_STATUS_CLOSED) {
+            HILOG_ERROR("Process failed, thread is closed!");
+            return;
+        }
 
-    if (status_ == SafeAsyncStatus::SAFE_ASYNC_STATUS_CLOSING) {
-        HILOG_DEBUG("threadsafe function is closing!");
-        CloseHandles();
-        return;
+        if (status_ == SafeAsyncStatus::SAFE_ASYNC_STATUS_CLOSING) {
+            HILOG_DEBUG("threadsafe function is closing!");
+            CloseHandles();
+            return;
+        }
     }
 
-    size_t size = queue_.size();
+    size_t size = queue_.Size();
+    size_t drained = 0;
+    bool deferred = false;
+    auto drainBegin = std::chrono::steady_clock::now();
     void* data = nullptr;
 
     auto vm = engine_->GetEcmaVm();
@@ -338,49 +560,156 @@ void NativeSafeAsyncWork::ProcessAsyncHandle()
         loop = engine_->GetParent()->GetUVLoop();
     }
 
+    if (callJsBatchCallback_ != nullptr) {
+        // everything published so far goes to js in a single invocation
+        batchItems_.clear();
+        while (size > 0) {
+            if (IsDrainBudgetExhausted(batchItems_.size(), drainBegin)) {
+                deferred = true;
+                break;
+            }
+            if (!queue_.TryPop(data)) {
+                break;
+            }
+            batchItems_.push_back(UnwrapItem(data, true));
+            size--;
+        }
+        drained = batchItems_.size();
+        NotifyBlockedProducer(drained);
+        if (!batchItems_.empty()) {
+            napi_value func_ = (ref_ == nullptr) ? nullptr : ref_->Get(engine_);
+#if defined(ENABLE_EVENT_HANDLER)
+            uv_call_specify_task(loop);
+#endif
+            CallJsBatchCallback(func_, batchItems_.data(), batchItems_.size());
+            if (tryCatch.HasCaught()) {
+                engine_->HandleUncaughtException();
+            }
+        }
+        size = 0;
+    }
+
     while (size > 0) {
-        data = queue_.front();
-        // when queue is full, notify send.
-        if (size == maxQueueSize_ && maxQueueSize_ > 0) {
-            condition_.notify_one();
+        if (IsDrainBudgetExhausted(drained, drainBegin)) {
+            deferred = true;
+            break;
         }
+        // a producer may have reserved a slot without publishing it yet, its uv_async_send wakes us again
+        if (!queue_.TryPop(data)) {
+            break;
+        }
+        drained++;
+        data = UnwrapItem(data, true);
+        // the item left the queue, let a blocked producer fill the slot.
+        NotifyBlockedProducer(1);
         napi_value func_ = (ref_ == nullptr) ? nullptr : ref_->Get(engine_);
-        lock.unlock();
 #if defined(ENABLE_EVENT_HANDLER)
     uv_call_specify_task(loop);
 #endif
-        if (callJsCallback_ != nullptr) {
-            NativeEngine::ExecuteCallback(__FUNCTION__, callJsCallback_, engine_, func_, context_, data);
-            if (engine_->HasCriticalScope()) {
-                HILOG_FATAL("critical scope still open after user callback (ID: %{public}" PRIuPTR ") returned",
-                            reinterpret_cast<uintptr_t>(callJsCallback_));
-            }
-        } else {
-            CallJs(engine_, func_, context_, data);
-        }
-        lock.lock();
+        CallJsCallback(func_, data);
 
         if (tryCatch.HasCaught()) {
             engine_->HandleUncaughtException();
         }
-
-        queue_.pop_front();
         size--;
     }
     RestoreTraceId(isValidTraceId);
+    OnItemsDrained();
+
+    if (deferred) {
+        // yield to the loop, the re-armed handle continues with the rest on the next iteration
+        deferredDrains_.fetch_add(1, std::memory_order_relaxed);
+        deferredItems_.fetch_add(queue_.Size(), std::memory_order_relaxed);
+    }
 
-    if (!queue_.empty()) {
+    if (!queue_.Empty()) {
         auto ret = uv_async_send(&asyncHandler_);
         if (ret != 0) {
             HILOG_ERROR("uv async send failed in ProcessAsyncHandle ret = %{public}d", ret);
         }
     }
 
-    if (queue_.empty() && threadCount_ == 0) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (queue_.Empty() && threadCount_ == 0) {
         CloseHandles();
     }
 }
 
+void NativeSafeAsyncWork::CallJsCallback(napi_value func, void* data)
+{
+    if (callJsCallback_ != nullptr) {
+        NativeEngine::ExecuteCallback(__FUNCTION__, callJsCallback_, engine_, func, context_, data);
+        if (engine_->HasCriticalScope()) {
+            HILOG_FATAL("critical scope still open after user callback (ID: %{public}" PRIuPTR ") returned",
+                        reinterpret_cast<uintptr_t>(callJsCallback_));
+        }
+    } else {
+        CallJs(engine_, func, context_, data);
+    }
+}
+
+void NativeSafeAsyncWork::CallJsBatchCallback(napi_value func, void** items, size_t count)
+{
+    NativeEngine::ExecuteCallback(__FUNCTION__, callJsBatchCallback_, engine_, func, context_, items, count);
+    if (engine_->HasCriticalScope()) {
+        HILOG_FATAL("critical scope still open after user callback (ID: %{public}" PRIuPTR ") returned",
+                    reinterpret_cast<uintptr_t>(callJsBatchCallback_));
+    }
+}
+
+bool NativeSafeAsyncWork::IsDrainBudgetExhausted(size_t drained,
+                                                 const std::chrono::steady_clock::time_point& begin) const
+{
+    // every wakeup makes progress by at least one item
+    if (drained == 0) {
+        return false;
+    }
+    size_t itemBudget = drainItemBudget_.load(std::memory_order_relaxed);
+    if (itemBudget > 0 && drained >= itemBudget) {
+        return true;
+    }
+    uint64_t timeBudgetUs = drainTimeBudgetUs_.load(std::memory_order_relaxed);
+    if (timeBudgetUs == 0) {
+        return false;
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - begin);
+    return static_cast<uint64_t>(elapsed.count()) >= timeBudgetUs;
+}
+
+void* NativeSafeAsyncWork::UnwrapItem(void* item, bool record)
+{
+    if (!recordLatency_) {
+        return item;
+    }
+    auto timedItem = reinterpret_cast<NativeSafeAsyncTimedItem*>(item);
+    void* data = timedItem->data;
+    // items dropped on close never reach call_js and are not recorded, nor are items drained after recording
+    // was turned off, the wrapper stays for the lifetime of the tsfn
+    if (record && engine_->GetTaskLatencyRecorder().IsEnabled()) {
+        engine_->GetTaskLatencyRecorder().Record(latencyName_, NativeLatencyPhase::CALL_JS, timedItem->sentNs,
+            NativeTaskLatencyRecorder::Now());
+    }
+    delete timedItem;
+    return data;
+}
+
+void NativeSafeAsyncWork::SetDrainBudget(size_t maxItems, uint64_t maxTimeUs)
+{
+    drainItemBudget_.store(maxItems, std::memory_order_relaxed);
+    drainTimeBudgetUs_.store(maxTimeUs, std::memory_order_relaxed);
+}
+
+void NativeSafeAsyncWork::GetDrainStats(uint64_t& deferredDrains, uint64_t& deferredItems) const
+{
+    deferredDrains = deferredDrains_.load(std::memory_order_relaxed);
+    deferredItems = deferredItems_.load(std::memory_order_relaxed);
+}
+
+void NativeSafeAsyncWork::SetCallJsBatchCallback(NativeThreadSafeFunctionCallJsBatch callJsBatchCallback)
+{
+    callJsBatchCallback_ = callJsBatchCallback;
+}
+
 SafeAsyncCode NativeSafeAsyncWork::CloseHandles()
 {
     HILOG_DEBUG("NativeSafeAsyncWork::CloseHandles called");
@@ -391,6 +720,8 @@ SafeAsyncCode NativeSafeAsyncWork::CloseHandles()
     }
 
     status_ = SafeAsyncStatus::SAFE_ASYNC_STATUS_CLOSED;
+    // wake up producers blocked on a full queue, they will observe the closed status
+    condition_.notify_all();
 
     // close async handler
     uv_close(reinterpret_cast<uv_handle_t*>(&asyncHandler_), [](uv_handle_t* handle) {
@@ -410,14 +741,26 @@ void NativeSafeAsyncWork::CleanUp()
         NativeEngine::ExecuteCallback(__FUNCTION__, finalizeCallback_, engine_, finalizeData_, context_);
     }
 
+    // producers which passed the status check before closing may still be publishing
+    WaitForInflightProducers();
     // clean data
-    while (!queue_.empty()) {
+    void* data = nullptr;
+    if (callJsBatchCallback_ != nullptr) {
+        batchItems_.clear();
+        while (queue_.TryPop(data)) {
+            batchItems_.push_back(UnwrapItem(data, false));
+        }
+        if (!batchItems_.empty()) {
+            callJsBatchCallback_(nullptr, nullptr, context_, batchItems_.data(), batchItems_.size());
+        }
+    }
+    while (queue_.TryPop(data)) {
+        data = UnwrapItem(data, false);
         if (callJsCallback_ != nullptr) {
-            callJsCallback_(nullptr, nullptr, context_, queue_.front());
+            callJsCallback_(nullptr, nullptr, context_, data);
         } else {
-            CallJs(nullptr, nullptr, context_, queue_.front());
+            CallJs(nullptr, nullptr, context_, data);
         }
-        queue_.pop_front();
     }
     ClearTraceId(isValidTraceId);
 
@@ -434,43 +777,52 @@ napi_status NativeSafeAsyncWork::PostTask(void *data, int32_t priority, bool isT
 {
 #if defined(ENABLE_EVENT_HANDLER)
     HILOG_DEBUG("NativeSafeAsyncWork::PostTask called");
-    std::unique_lock<std::mutex> lock(eventHandlerMutex_);
-    if (engine_ == nullptr || eventHandler_ == nullptr) {
-        HILOG_ERROR("post task failed due to nullptr engine or eventHandler");
-        return napi_status::napi_generic_failure;
-    }
-    // the task will be execute at main thread or worker thread
-    auto task = [this, data]() {
-        HILOG_DEBUG("The task is executing in main thread or worker thread");
-        panda::LocalScope scope(this->engine_->GetEcmaVm());
-        napi_value func_ = (this->ref_ == nullptr) ? nullptr : this->ref_->Get(engine_);
-        bool isValidTraceId = SaveAndSetTraceId();
-        if (this->callJsCallback_ != nullptr) {
-            this->callJsCallback_(engine_, func_, context_, data);
-            if (engine_->HasCriticalScope()) {
-                HILOG_FATAL("critical scope still open after user callback (ID: %{public}" PRIuPTR ") returned",
-                            reinterpret_cast<uintptr_t>(callJsCallback_));
-            }
-        } else {
-            CallJs(engine_, func_, context_, data);
+    {
+        std::unique_lock<std::mutex> lock(eventHandlerMutex_);
+        if (engine_ == nullptr) {
+            HILOG_ERROR("post task failed due to nullptr engine");
+            return napi_status::napi_generic_failure;
         }
-        RestoreTraceId(isValidTraceId);
-    };
+        if (eventHandler_ != nullptr) {
+            // the task will be execute at main thread or worker thread
+            auto task = [this, data]() {
+                HILOG_DEBUG("The task is executing in main thread or worker thread");
+                panda::LocalScope scope(this->engine_->GetEcmaVm());
+                napi_value func_ = (this->ref_ == nullptr) ? nullptr : this->ref_->Get(engine_);
+                bool isValidTraceId = SaveAndSetTraceId();
+                if (this->callJsBatchCallback_ != nullptr) {
+                    void* items[] = { data };
+                    this->CallJsBatchCallback(func_, items, 1);
+                } else {
+                    this->CallJsCallback(func_, data);
+                }
+                RestoreTraceId(isValidTraceId);
+            };
+
+            bool res = false;
+            if (isTail) {
+                HILOG_DEBUG("The task is posted from tail");
+                res = eventHandler_->PostTask(task, static_cast<EventQueue::Priority>(priority));
+            } else {
+                HILOG_DEBUG("The task is posted from head");
+                res = eventHandler_->PostTaskAtFront(task, std::string(), static_cast<EventQueue::Priority>(priority));
+            }
 
-    bool res = false;
-    if (isTail) {
-        HILOG_DEBUG("The task is posted from tail");
-        res = eventHandler_->PostTask(task, static_cast<EventQueue::Priority>(priority));
-    } else {
-        HILOG_DEBUG("The task is posted from head");
-        res = eventHandler_->PostTaskAtFront(task, std::string(), static_cast<EventQueue::Priority>(priority));
+            return res ? napi_status::napi_ok : napi_status::napi_generic_failure;
+        }
     }
-
-    return res ? napi_status::napi_ok : napi_status::napi_generic_failure;
-#else
-    HILOG_WARN("EventHandler feature is not supported");
-    return napi_status::napi_generic_failure;
 #endif
+    // without an event handler the item goes to the lane of the uv queue matching its priority
+    switch (SendToLane(data, static_cast<SafeAsyncLane>(priority), isTail)) {
+        case SafeAsyncCode::SAFE_ASYNC_OK:
+            return napi_status::napi_ok;
+        case SafeAsyncCode::SAFE_ASYNC_INVALID_ARGS:
+            return napi_status::napi_invalid_arg;
+        case SafeAsyncCode::SAFE_ASYNC_CLOSED:
+            return napi_status::napi_closing;
+        default:
+            return napi_status::napi_generic_failure;
+    }
 }
 
 void NativeSafeAsyncWork::InitSafeAsyncWorkTraceId()
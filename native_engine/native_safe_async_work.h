@@ -18,14 +18,18 @@
 
 #include "native_value.h"
 
+#include <atomic>
+#include <chrono>
 #include <mutex>
-#include <deque>
+#include <string>
 #include <uv.h>
+#include <vector>
 #ifdef LINUX_PLATFORM
 #include <condition_variable>
 #endif
 
 #include "native_async_context.h"
+#include "native_safe_async_queue.h"
 #ifdef ENABLE_HITRACE
 #include "hitrace/trace.h"
 #endif
@@ -60,6 +64,30 @@ enum class SafeAsyncStatus {
     SAFE_ASYNC_STATUS_CLOSED,
 };
 
+using NativeThreadSafeFunctionWatermark = void (*)(void* safeAsyncWork, void* context, size_t depth, bool isHigh);
+
+struct NativeSafeAsyncFlowControl {
+    // 0 disables the watermark notifications, otherwise lowWatermark must be below highWatermark
+    size_t highWatermark = 0;
+    size_t lowWatermark = 0;
+    NativeThreadSafeFunctionWatermark watermarkCallback = nullptr;
+    // 0 makes a blocking send wait until there is space or the function is closing
+    uint64_t blockingTimeoutMs = 0;
+};
+
+struct NativeSafeAsyncQueueStats {
+    size_t depth = 0;
+    size_t peakDepth = 0;
+    uint64_t blockedCalls = 0;
+    uint64_t blockedTimeUs = 0;
+    uint64_t timeouts = 0;
+};
+
+struct NativeSafeAsyncTimedItem {
+    void* data = nullptr;
+    uint64_t sentNs = 0;
+};
+
 class NativeSafeAsyncWork {
 public:
     static void AsyncCallback(uv_async_t* asyncHandler);
@@ -79,19 +107,42 @@ public:
     virtual ~NativeSafeAsyncWork();
     virtual bool Init();
     virtual SafeAsyncCode Send(void* data, NativeThreadSafeFunctionCallMode mode);
+    virtual SafeAsyncCode SendBatch(void* const* items, size_t count, NativeThreadSafeFunctionCallMode mode);
     virtual SafeAsyncCode Acquire();
     virtual SafeAsyncCode Release(NativeThreadSafeFunctionReleaseMode mode);
     virtual bool Ref();
     virtual bool Unref();
     virtual void* GetContext();
     virtual napi_status PostTask(void *data, int32_t priority, bool isTail);
+    // must be set before Init, the batch callback then replaces the per item call_js
+    void SetCallJsBatchCallback(NativeThreadSafeFunctionCallJsBatch callJsBatchCallback);
+    // limits the items and the time spent in js per wakeup, 0 means unlimited
+    void SetDrainBudget(size_t maxItems, uint64_t maxTimeUs);
+    void GetDrainStats(uint64_t& deferredDrains, uint64_t& deferredItems) const;
+    // must be set before Init
+    bool SetFlowControl(const NativeSafeAsyncFlowControl& flowControl);
+    void GetQueueStats(NativeSafeAsyncQueueStats& stats) const;
 
 protected:
     void ProcessAsyncHandle();
     SafeAsyncCode CloseHandles();
     void CleanUp();
     bool IsSameTid();
-    bool IsMaxQueueSize();
+    bool IsClosingOrClosed() const;
+    // like SendBatch, a call on a closing function releases the calling thread unless releaseThread is false
+    SafeAsyncCode SendToLane(void* data, SafeAsyncLane lane, bool isTail, bool releaseThread = true);
+    SafeAsyncCode WaitForQueueSpace(void* const* items, size_t count);
+    // a call on a closing or closed function releases the calling thread, mutex_ must be held
+    SafeAsyncCode ReleaseThreadOnClosed();
+    void NotifyBlockedProducer(size_t freed);
+    void CallJsCallback(napi_value func, void* data);
+    void CallJsBatchCallback(napi_value func, void** items, size_t count);
+    void OnItemsQueued();
+    void OnItemsDrained();
+    bool IsDrainBudgetExhausted(size_t drained, const std::chrono::steady_clock::time_point& begin) const;
+    void WaitForInflightProducers();
+    // with latency recording on, the queue holds NativeSafeAsyncTimedItem wrappers instead of the user data
+    void* UnwrapItem(void* item, bool record);
 
     SafeAsyncCode ValidEngineCheck();
 
@@ -104,12 +155,33 @@ protected:
     NativeFinalize finalizeCallback_ = nullptr;
     void* context_ = nullptr;
     NativeThreadSafeFunctionCallJs callJsCallback_ = nullptr;
+    NativeThreadSafeFunctionCallJsBatch callJsBatchCallback_ = nullptr;
+    // only touched on the js thread, reused across drains to avoid an allocation per wakeup
+    std::vector<void*> batchItems_;
+    std::atomic<size_t> drainItemBudget_ { 0 };
+    std::atomic<uint64_t> drainTimeBudgetUs_ { 0 };
+    // wakeups which stopped on the budget and the items they left for the next wakeup
+    std::atomic<uint64_t> deferredDrains_ { 0 };
+    std::atomic<uint64_t> deferredItems_ { 0 };
+    // decided at creation so every queued item has the same layout
+    bool recordLatency_ = false;
+    std::string latencyName_;
+    NativeSafeAsyncFlowControl flowControl_;
+    // set between the high watermark notification and the matching low one
+    std::atomic<bool> aboveHighWatermark_ { false };
+    std::atomic<size_t> peakDepth_ { 0 };
+    std::atomic<uint64_t> blockedCalls_ { 0 };
+    std::atomic<uint64_t> blockedTimeUs_ { 0 };
+    std::atomic<uint64_t> timeouts_ { 0 };
     NativeAsyncContext asyncContext_;
     uv_async_t asyncHandler_;
+    // guards threadCount_, status transitions and the blocking wait, Send does not take it on the fast path
     std::mutex mutex_;
-    std::deque<void*> queue_;
+    NativeSafeAsyncLaneQueue queue_;
     std::condition_variable condition_;
-    SafeAsyncStatus status_ = SafeAsyncStatus::UNKNOW;
+    std::atomic<size_t> blockedProducers_ { 0 };
+    std::atomic<size_t> inflightProducers_ { 0 };
+    std::atomic<SafeAsyncStatus> status_ { SafeAsyncStatus::UNKNOW };
 #if defined(ENABLE_EVENT_HANDLER)
     std::mutex eventHandlerMutex_;
     std::shared_ptr<OHOS::AppExecFwk::EventHandler> eventHandler_ = nullptr;
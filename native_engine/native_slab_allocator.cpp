@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "native_slab_allocator.h"
+
+#include <new>
+
+#include "utils/log.h"
+
+namespace {
+// a fully free chunk is kept per size class so an alloc/free pattern at a chunk boundary does not thrash
+constexpr size_t MAX_EMPTY_CHUNKS = 1;
+constexpr size_t HEADER_ALIGN = 64;
+} // namespace
+
+NativeSlabAllocator::~NativeSlabAllocator()
+{
+    for (auto& sizeClass : classes_) {
+        while (sizeClass.available != nullptr) {
+            Chunk* chunk = sizeClass.available;
+            UnlinkAvailable(chunk);
+            ReleaseChunk(chunk);
+        }
+    }
+}
+
+size_t NativeSlabAllocator::HeaderSize()
+{
+    return (sizeof(Chunk) + HEADER_ALIGN - 1) / HEADER_ALIGN * HEADER_ALIGN;
+}
+
+NativeSlabAllocator::Chunk* NativeSlabAllocator::ChunkOf(void* ptr)
+{
+    return reinterpret_cast<Chunk*>(reinterpret_cast<uintptr_t>(ptr) & ~static_cast<uintptr_t>(CHUNK_SIZE - 1));
+}
+
+NativeSlabAllocator::Chunk* NativeSlabAllocator::NewChunk(size_t sizeClass)
+{
+    void* memory = ::operator new(CHUNK_SIZE, std::align_val_t(CHUNK_SIZE), std::nothrow);
+    if (memory == nullptr) {
+        HILOG_ERROR("failed to allocate a slab chunk");
+        return nullptr;
+    }
+    auto chunk = new (memory) Chunk();
+    chunk->owner = this;
+    chunk->sizeClass = sizeClass;
+    chunk->capacity = (CHUNK_SIZE - HeaderSize()) / ((sizeClass + 1) * SLOT_ALIGN);
+    classes_[sizeClass].chunks++;
+    classes_[sizeClass].emptyChunks++;
+    LinkAvailable(chunk);
+    return chunk;
+}
+
+void NativeSlabAllocator::ReleaseChunk(Chunk* chunk)
+{
+    classes_[chunk->sizeClass].chunks--;
+    if (chunk->used == 0) {
+        classes_[chunk->sizeClass].emptyChunks--;
+    }
+    chunk->~Chunk();
+    ::operator delete(chunk, std::align_val_t(CHUNK_SIZE));
+}
+
+void NativeSlabAllocator::LinkAvailable(Chunk* chunk)
+{
+    auto& sizeClass = classes_[chunk->sizeClass];
+    chunk->prev = nullptr;
+    chunk->next = sizeClass.available;
+    if (sizeClass.available != nullptr) {
+        sizeClass.available->prev = chunk;
+    }
+    sizeClass.available = chunk;
+}
+
+void NativeSlabAllocator::UnlinkAvailable(Chunk* chunk)
+{
+    auto& sizeClass = classes_[chunk->sizeClass];
+    if (chunk->prev != nullptr) {
+        chunk->prev->next = chunk->next;
+    } else {
+        sizeClass.available = chunk->next;
+    }
+    if (chunk->next != nullptr) {
+        chunk->next->prev = chunk->prev;
+    }
+    chunk->prev = nullptr;
+    chunk->next = nullptr;
+}
+
+void* NativeSlabAllocator::AllocateLocked(size_t sizeClass)
+{
+    Chunk* chunk = classes_[sizeClass].available;
+    if (chunk == nullptr) {
+        chunk = NewChunk(sizeClass);
+        if (chunk == nullptr) {
+            return nullptr;
+        }
+    }
+    void* slot = nullptr;
+    if (chunk->freeList != nullptr) {
+        slot = chunk->freeList;
+        chunk->freeList = *reinterpret_cast<void**>(slot);
+    } else {
+        slot = reinterpret_cast<char*>(chunk) + HeaderSize() + chunk->carved * (sizeClass + 1) * SLOT_ALIGN;
+        chunk->carved++;
+    }
+    if (chunk->used++ == 0) {
+        classes_[sizeClass].emptyChunks--;
+    }
+    if (chunk->used == chunk->capacity) {
+        UnlinkAvailable(chunk);
+    }
+    liveObjects_++;
+    allocations_++;
+    return slot;
+}
+
+void* NativeSlabAllocator::Allocate(size_t size)
+{
+    if (size == 0 || size > MAX_SLOT_SIZE) {
+        HILOG_ERROR("slab allocation of %{public}zu bytes is not supported", size);
+        return nullptr;
+    }
+    size_t sizeClass = (size + SLOT_ALIGN - 1) / SLOT_ALIGN - 1;
+    std::lock_guard<std::mutex> lock(mutex_);
+    return AllocateLocked(sizeClass);
+}
+
+bool NativeSlabAllocator::AllocateBatch(size_t size, size_t count, void** slots)
+{
+    if (size == 0 || size > MAX_SLOT_SIZE) {
+        HILOG_ERROR("slab allocation of %{public}zu bytes is not supported", size);
+        return false;
+    }
+    size_t sizeClass = (size + SLOT_ALIGN - 1) / SLOT_ALIGN - 1;
+    size_t allocated = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        // one lock for the batch, slots freed earlier are reused first and the rest is carved in address order,
+        // so a batch taken from a fresh chunk is contiguous
+        while (allocated < count) {
+            void* slot = AllocateLocked(sizeClass);
+            if (slot == nullptr) {
+                break;
+            }
+            slots[allocated++] = slot;
+        }
+    }
+    if (allocated == count) {
+        return true;
+    }
+    for (size_t i = 0; i < allocated; ++i) {
+        Free(slots[i]);
+    }
+    return false;
+}
+
+bool NativeSlabAllocator::FreeSlot(Chunk* chunk, void* ptr)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (chunk->used == chunk->capacity) {
+        LinkAvailable(chunk);
+    }
+    *reinterpret_cast<void**>(ptr) = chunk->freeList;
+    chunk->freeList = ptr;
+    liveObjects_--;
+    frees_++;
+    if (--chunk->used == 0) {
+        auto& sizeClass = classes_[chunk->sizeClass];
+        sizeClass.emptyChunks++;
+        if (sizeClass.emptyChunks > MAX_EMPTY_CHUNKS) {
+            UnlinkAvailable(chunk);
+            ReleaseChunk(chunk);
+        }
+    }
+    return detached_ && liveObjects_ == 0;
+}
+
+void NativeSlabAllocator::Free(void* ptr)
+{
+    if (ptr == nullptr) {
+        return;
+    }
+    Chunk* chunk = ChunkOf(ptr);
+    NativeSlabAllocator* owner = chunk->owner;
+    if (owner->FreeSlot(chunk, ptr)) {
+        delete owner;
+    }
+}
+
+void NativeSlabAllocator::Detach()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        detached_ = true;
+        if (liveObjects_ != 0) {
+            HILOG_DEBUG("slab allocator outlives its owner, %{public}zu objects alive", liveObjects_);
+            return;
+        }
+    }
+    delete this;
+}
+
+void NativeSlabAllocator::GetStats(NativeSlabStats& stats) const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    stats = NativeSlabStats();
+    for (size_t i = 0; i < CLASS_COUNT; ++i) {
+        size_t capacity = (CHUNK_SIZE - HeaderSize()) / ((i + 1) * SLOT_ALIGN);
+        stats.chunks += classes_[i].chunks;
+        stats.freeSlots += classes_[i].chunks * capacity;
+    }
+    stats.liveObjects = liveObjects_;
+    stats.freeSlots -= liveObjects_;
+    stats.reservedBytes = stats.chunks * CHUNK_SIZE;
+    stats.allocations = allocations_;
+    stats.frees = frees_;
+}
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_NAPI_NATIVE_ENGINE_NATIVE_SLAB_ALLOCATOR_H
+#define FOUNDATION_ACE_NAPI_NATIVE_ENGINE_NATIVE_SLAB_ALLOCATOR_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+struct NativeSlabStats {
+    size_t chunks = 0;
+    size_t liveObjects = 0;
+    // slots of the chunks which are not handed out, the lazily carved part of a chunk included
+    size_t freeSlots = 0;
+    size_t reservedBytes = 0;
+    uint64_t allocations = 0;
+    uint64_t frees = 0;
+};
+
+/*
+ * Fixed size slab allocator for small, long lived engine objects such as references.
+ * Sizes are rounded up to SLOT_ALIGN and every size class carves its slots from CHUNK_SIZE chunks aligned to
+ * CHUNK_SIZE, so Free finds the chunk and its allocator from the pointer alone and needs no size or owner.
+ * The owner Detaches the allocator instead of deleting it, it then goes away with its last object, so objects
+ * outliving their engine can still be freed safely from any thread.
+ */
+class NativeSlabAllocator {
+public:
+    static constexpr size_t CHUNK_SIZE = 64 * 1024;
+    static constexpr size_t SLOT_ALIGN = 16;
+    static constexpr size_t MAX_SLOT_SIZE = 512;
+    static constexpr size_t CLASS_COUNT = MAX_SLOT_SIZE / SLOT_ALIGN;
+
+    NativeSlabAllocator() = default;
+
+    NativeSlabAllocator(const NativeSlabAllocator&) = delete;
+    NativeSlabAllocator& operator=(const NativeSlabAllocator&) = delete;
+
+    // returns nullptr when size is above MAX_SLOT_SIZE or no chunk can be allocated
+    void* Allocate(size_t size);
+    // allocates count slots of size under one lock, all or none, returns false when not all could be allocated
+    bool AllocateBatch(size_t size, size_t count, void** slots);
+    // ptr must come from Allocate of any allocator, can be called from any thread
+    static void Free(void* ptr);
+    // replaces delete for the owner, no allocation may follow
+    void Detach();
+    void GetStats(NativeSlabStats& stats) const;
+
+private:
+    struct Chunk {
+        NativeSlabAllocator* owner = nullptr;
+        Chunk* prev = nullptr;
+        Chunk* next = nullptr;
+        void* freeList = nullptr;
+        size_t sizeClass = 0;
+        size_t used = 0;
+        // slots below carved were handed out at least once, the rest was never touched
+        size_t carved = 0;
+        size_t capacity = 0;
+    };
+    struct SizeClass {
+        // chunks with at least one free slot
+        Chunk* available = nullptr;
+        size_t chunks = 0;
+        size_t emptyChunks = 0;
+    };
+
+    ~NativeSlabAllocator();
+
+    static size_t HeaderSize();
+    static Chunk* ChunkOf(void* ptr);
+    Chunk* NewChunk(size_t sizeClass);
+    void* AllocateLocked(size_t sizeClass);
+    void ReleaseChunk(Chunk* chunk);
+    void LinkAvailable(Chunk* chunk);
+    void UnlinkAvailable(Chunk* chunk);
+    // returns true when the allocator has to be deleted by the caller
+    bool FreeSlot(Chunk* chunk, void* ptr);
+
+    mutable std::mutex mutex_;
+    std::array<SizeClass, CLASS_COUNT> classes_ {};
+    size_t liveObjects_ = 0;
+    uint64_t allocations_ = 0;
+    uint64_t frees_ = 0;
+    bool detached_ = false;
+};
+
+#endif /* FOUNDATION_ACE_NAPI_NATIVE_ENGINE_NATIVE_SLAB_ALLOCATOR_H */
@@ -0,0 +1,215 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "native_task_latency.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <vector>
+
+#include "native_json_writer.h"
+
+namespace {
+constexpr uint64_t NS_PER_US = 1000;
+constexpr double P50 = 0.5;
+constexpr double P90 = 0.9;
+constexpr double P99 = 0.99;
+const char* const PHASE_NAMES[NativeTaskLatencyRecorder::PHASE_COUNT] = {
+    "queueWait", "execute", "complete", "callJs"
+};
+
+void AppendHistogram(std::string& out, const NativeLatencyHistogram& histogram)
+{
+    out += '{';
+    NativeJsonWriter::AppendNumber(out, "count", histogram.GetCount());
+    out += ',';
+    NativeJsonWriter::AppendNumber(out, "totalUs", histogram.GetTotal());
+    out += ',';
+    NativeJsonWriter::AppendNumber(out, "maxUs", histogram.GetMax());
+    out += ',';
+    NativeJsonWriter::AppendNumber(out, "p50Us", histogram.GetPercentile(P50));
+    out += ',';
+    NativeJsonWriter::AppendNumber(out, "p90Us", histogram.GetPercentile(P90));
+    out += ',';
+    NativeJsonWriter::AppendNumber(out, "p99Us", histogram.GetPercentile(P99));
+    // only the non-empty buckets, as [upper bound in us, count]
+    out += ",\"buckets\":[";
+    bool first = true;
+    for (size_t i = 0; i < NativeLatencyHistogram::BUCKET_COUNT; ++i) {
+        uint64_t count = histogram.GetBucketCount(i);
+        if (count == 0) {
+            continue;
+        }
+        if (!first) {
+            out += ',';
+        }
+        first = false;
+        out += '[';
+        out += std::to_string(NativeLatencyHistogram::GetBucketUpperBound(i));
+        out += ',';
+        out += std::to_string(count);
+        out += ']';
+    }
+    out += "]}";
+}
+} // namespace
+
+size_t NativeLatencyHistogram::GetBucketIndex(uint64_t valueUs)
+{
+    if (valueUs < SUB_BUCKETS) {
+        return static_cast<size_t>(valueUs);
+    }
+    size_t exponent = static_cast<size_t>(63 - __builtin_clzll(valueUs));
+    if (exponent >= MAX_EXPONENT) {
+        return BUCKET_COUNT - 1;
+    }
+    size_t shift = exponent - LINEAR_BITS;
+    return (exponent - LINEAR_BITS + 1) * SUB_BUCKETS + static_cast<size_t>((valueUs >> shift) & (SUB_BUCKETS - 1));
+}
+
+uint64_t NativeLatencyHistogram::GetBucketUpperBound(size_t index)
+{
+    if (index < SUB_BUCKETS) {
+        return index;
+    }
+    size_t shift = index / SUB_BUCKETS - 1;
+    uint64_t lower = static_cast<uint64_t>(SUB_BUCKETS + index % SUB_BUCKETS) << shift;
+    return lower + (static_cast<uint64_t>(1) << shift) - 1;
+}
+
+void NativeLatencyHistogram::Record(uint64_t valueUs, uint64_t times)
+{
+    if (times == 0) {
+        return;
+    }
+    buckets_[GetBucketIndex(valueUs)] += times;
+    count_ += times;
+    total_ += valueUs * times;
+    max_ = std::max(max_, valueUs);
+}
+
+uint64_t NativeLatencyHistogram::GetPercentile(double ratio) const
+{
+    if (count_ == 0) {
+        return 0;
+    }
+    uint64_t target = static_cast<uint64_t>(std::ceil(ratio * static_cast<double>(count_)));
+    target = std::max<uint64_t>(1, std::min(target, count_));
+    uint64_t seen = 0;
+    for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+        seen += buckets_[i];
+        if (seen >= target) {
+            return std::min(GetBucketUpperBound(i), max_);
+        }
+    }
+    return max_;
+}
+
+void NativeLatencyHistogram::GetStats(NativeLatencyStats& stats) const
+{
+    stats.count = count_;
+    stats.totalUs = total_;
+    stats.maxUs = max_;
+    stats.p50Us = GetPercentile(P50);
+    stats.p90Us = GetPercentile(P90);
+    stats.p99Us = GetPercentile(P99);
+}
+
+uint64_t NativeTaskLatencyRecorder::Now()
+{
+    auto now = std::chrono::steady_clock::now().time_since_epoch();
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(now).count());
+}
+
+NativeLatencyHistogram& NativeTaskLatencyRecorder::GetHistogram(const std::string& name, NativeLatencyPhase phase)
+{
+    auto iter = tasks_.find(name);
+    if (iter == tasks_.end()) {
+        const std::string& key = tasks_.size() < MAX_TASK_NAMES ? name : OVERFLOW_NAME;
+        iter = tasks_.try_emplace(key).first;
+    }
+    auto& histogram = iter->second[static_cast<size_t>(phase)];
+    if (histogram == nullptr) {
+        histogram = std::make_unique<NativeLatencyHistogram>();
+    }
+    return *histogram;
+}
+
+void NativeTaskLatencyRecorder::Record(const std::string& name, NativeLatencyPhase phase,
+                                       uint64_t beginNs, uint64_t endNs)
+{
+    uint64_t valueUs = endNs > beginNs ? (endNs - beginNs) / NS_PER_US : 0;
+    std::lock_guard<std::mutex> lock(mutex_);
+    GetHistogram(name, phase).Record(valueUs);
+}
+
+void NativeTaskLatencyRecorder::RecordAsyncWork(const std::string& name, const NativeTaskTimes& times,
+                                                uint64_t completedNs)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (times.startedNs != 0) {
+        GetHistogram(name, NativeLatencyPhase::QUEUE_WAIT).Record((times.startedNs - times.queuedNs) / NS_PER_US);
+        GetHistogram(name, NativeLatencyPhase::EXECUTE).Record((times.executedNs - times.startedNs) / NS_PER_US);
+    }
+    uint64_t completeBeginNs = times.executedNs != 0 ? times.executedNs : times.queuedNs;
+    GetHistogram(name, NativeLatencyPhase::COMPLETE).Record((completedNs - completeBeginNs) / NS_PER_US);
+}
+
+bool NativeTaskLatencyRecorder::GetStats(const std::string& name, NativeLatencyPhase phase,
+                                         NativeLatencyStats& stats) const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = tasks_.find(name);
+    if (iter == tasks_.end() || iter->second[static_cast<size_t>(phase)] == nullptr) {
+        stats = NativeLatencyStats();
+        return false;
+    }
+    iter->second[static_cast<size_t>(phase)]->GetStats(stats);
+    return true;
+}
+
+std::string NativeTaskLatencyRecorder::DumpJson() const
+{
+    std::string out = "{\"tasks\":[";
+    std::lock_guard<std::mutex> lock(mutex_);
+    bool firstTask = true;
+    for (const auto& [name, histograms] : tasks_) {
+        if (!firstTask) {
+            out += ',';
+        }
+        firstTask = false;
+        out += "{\"name\":";
+        NativeJsonWriter::AppendString(out, name);
+        for (size_t phase = 0; phase < PHASE_COUNT; ++phase) {
+            if (histograms[phase] == nullptr) {
+                continue;
+            }
+            out += ",\"";
+            out += PHASE_NAMES[phase];
+            out += "\":";
+            AppendHistogram(out, *histograms[phase]);
+        }
+        out += '}';
+    }
+    out += "]}";
+    return out;
+}
+
+void NativeTaskLatencyRecorder::Reset()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    tasks_.clear();
+}
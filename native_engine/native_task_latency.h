@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_NAPI_NATIVE_ENGINE_NATIVE_TASK_LATENCY_H
+#define FOUNDATION_ACE_NAPI_NATIVE_ENGINE_NATIVE_TASK_LATENCY_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+struct NativeLatencyStats {
+    uint64_t count = 0;
+    uint64_t totalUs = 0;
+    uint64_t maxUs = 0;
+    uint64_t p50Us = 0;
+    uint64_t p90Us = 0;
+    uint64_t p99Us = 0;
+};
+
+/*
+ * Log-linear latency histogram in microseconds.
+ * Values below SUB_BUCKETS get a bucket each, above that every power of two is split in SUB_BUCKETS linear
+ * buckets, so a bucket bound is at most 25% away from the values it holds. Values from 2^MAX_EXPONENT us on
+ * share the last bucket. Not thread safe, NativeTaskLatencyRecorder guards it.
+ */
+class NativeLatencyHistogram {
+public:
+    static constexpr size_t LINEAR_BITS = 2;
+    static constexpr size_t SUB_BUCKETS = 1 << LINEAR_BITS;
+    static constexpr size_t MAX_EXPONENT = 32;
+    static constexpr size_t BUCKET_COUNT = SUB_BUCKETS * (MAX_EXPONENT - 1);
+
+    // records the value times times, for a batch of tasks which waited the same
+    void Record(uint64_t valueUs, uint64_t times = 1);
+    // smallest bucket bound below which at least ratio of the values are, capped by the max value
+    uint64_t GetPercentile(double ratio) const;
+    void GetStats(NativeLatencyStats& stats) const;
+
+    uint64_t GetCount() const
+    {
+        return count_;
+    }
+
+    uint64_t GetTotal() const
+    {
+        return total_;
+    }
+
+    uint64_t GetMax() const
+    {
+        return max_;
+    }
+
+    uint64_t GetBucketCount(size_t index) const
+    {
+        return buckets_[index];
+    }
+
+    static size_t GetBucketIndex(uint64_t valueUs);
+    // largest value held by the bucket
+    static uint64_t GetBucketUpperBound(size_t index);
+
+private:
+    uint64_t count_ = 0;
+    uint64_t total_ = 0;
+    uint64_t max_ = 0;
+    std::array<uint64_t, BUCKET_COUNT> buckets_ {};
+};
+
+enum class NativeLatencyPhase : size_t {
+    // async work: queued to execute start, execute, execute end to complete callback returned
+    QUEUE_WAIT = 0,
+    EXECUTE,
+    COMPLETE,
+    // threadsafe function: call to call_js start
+    CALL_JS,
+};
+
+// steady clock stamps of an async work, 0 when latency recording was off as it was queued
+struct NativeTaskTimes {
+    uint64_t queuedNs = 0;
+    uint64_t startedNs = 0;
+    uint64_t executedNs = 0;
+};
+
+/*
+ * Per engine latency histograms of async works and threadsafe functions, keyed by their resource name.
+ * Recording is off by default, then the hot paths only load the enabled flag and take no timestamps.
+ * Names beyond MAX_TASK_NAMES are aggregated under OVERFLOW_NAME.
+ */
+class NativeTaskLatencyRecorder {
+public:
+    static constexpr size_t PHASE_COUNT = 4;
+    static constexpr size_t MAX_TASK_NAMES = 128;
+    static constexpr const char* OVERFLOW_NAME = "<others>";
+
+    NativeTaskLatencyRecorder() = default;
+    ~NativeTaskLatencyRecorder() = default;
+
+    NativeTaskLatencyRecorder(const NativeTaskLatencyRecorder&) = delete;
+    NativeTaskLatencyRecorder& operator=(const NativeTaskLatencyRecorder&) = delete;
+
+    static uint64_t Now();
+
+    void SetEnabled(bool enabled)
+    {
+        enabled_.store(enabled, std::memory_order_relaxed);
+    }
+
+    bool IsEnabled() const
+    {
+        return enabled_.load(std::memory_order_relaxed);
+    }
+
+    void Record(const std::string& name, NativeLatencyPhase phase, uint64_t beginNs, uint64_t endNs);
+    // records the three async work phases, a work cancelled before it started only gets the complete phase
+    void RecordAsyncWork(const std::string& name, const NativeTaskTimes& times, uint64_t completedNs);
+
+    // returns false when nothing was recorded for the name and phase
+    bool GetStats(const std::string& name, NativeLatencyPhase phase, NativeLatencyStats& stats) const;
+    std::string DumpJson() const;
+    void Reset();
+
+private:
+    using PhaseHistograms = std::array<std::unique_ptr<NativeLatencyHistogram>, PHASE_COUNT>;
+
+    NativeLatencyHistogram& GetHistogram(const std::string& name, NativeLatencyPhase phase);
+
+    std::atomic<bool> enabled_ { false };
+    mutable std::mutex mutex_;
+    // ordered so the dump is stable
+    std::map<std::string, PhaseHistograms> tasks_;
+};
+
+#endif /* FOUNDATION_ACE_NAPI_NATIVE_ENGINE_NATIVE_TASK_LATENCY_H */
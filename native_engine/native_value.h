@@ -37,11 +37,16 @@ typedef napi_value (*NapiNativeCallback)(napi_env env, panda::JsiRuntimeCallInfo
 typedef void (*NativeFinalize)(NativeEngine* engine, void* data, void* hint);
 typedef void (*NativeAsyncExecuteCallback)(NativeEngine* engine, void* data);
 typedef void (*NativeAsyncCompleteCallback)(NativeEngine* engine, int status, void* data);
+typedef napi_status (*NativeAsyncBatchExecuteCallback)(NativeEngine* engine, void* data, size_t index);
+typedef void (*NativeAsyncBatchCompleteCallback)(NativeEngine* engine, napi_status status, void* data,
+                                                 const napi_status* itemStatus, size_t count);
 typedef void* (*DetachCallback)(NativeEngine* engine, void* value, void* hint);
 
 using ErrorPos = std::pair<uint32_t, uint32_t>;
 using NativeThreadSafeFunctionCallJs =
     void (*)(NativeEngine* env, napi_value js_callback, void* context, void* data);
+using NativeThreadSafeFunctionCallJsBatch =
+    void (*)(NativeEngine* env, napi_value js_callback, void* context, void** data, size_t count);
 
 struct NativeObjectInfo {
     static NativeObjectInfo* CreateNewInstance() { return new(std::nothrow) NativeObjectInfo(); }
@@ -19,34 +19,63 @@
 
 NativeReferenceManager::~NativeReferenceManager()
 {
-    for (auto handler = references_; handler != nullptr; handler = references_) {
-        references_ = reinterpret_cast<ArkNativeReference*>(handler)->next_;
-        delete handler;
+    // a deleted reference releases its own slot, and its finalizer may create runtime owned references which add a
+    // chunk or take a slot the scan passed already, so the chunks are indexed afresh and scanned until none is left
+    bool deleted = true;
+    while (deleted) {
+        deleted = false;
+        for (size_t chunk = 0; chunk < chunks_.size(); ++chunk) {
+            for (size_t slot = 0; slot < CHUNK_CAPACITY; ++slot) {
+                NativeReference* reference = (*chunks_[chunk])[slot];
+                if (reference != nullptr) {
+                    delete reference;
+                    deleted = true;
+                }
+            }
+        }
     }
 }
 
 void NativeReferenceManager::CreateHandler(NativeReference* reference)
 {
-    if (references_) {
-        reinterpret_cast<ArkNativeReference*>(references_)->prev_ = reference;
-        reinterpret_cast<ArkNativeReference*>(reference)->next_ = references_;
+    auto ref = reinterpret_cast<ArkNativeReference*>(reference);
+    size_t kind = static_cast<size_t>(ref->finalizerKind_);
+    if (ref->ownership_ != ReferenceOwnerShip::RUNTIME) {
+        stats_.userOwned[kind]++;
+        return;
     }
-    references_ = reference;
+    uint32_t index = 0;
+    if (!freeSlots_.empty()) {
+        index = freeSlots_.back();
+        freeSlots_.pop_back();
+    } else {
+        index = usedSlots_++;
+        if (index / CHUNK_CAPACITY == chunks_.size()) {
+            chunks_.emplace_back(std::make_unique<Chunk>());
+            chunks_.back()->fill(nullptr);
+        }
+    }
+    Slot(index) = reference;
+    ref->managerIndex_ = index;
+    stats_.runtimeOwned[kind]++;
 }
 
 void NativeReferenceManager::ReleaseHandler(NativeReference* reference)
 {
-    NativeReference* prev = reinterpret_cast<ArkNativeReference*>(reference)->prev_;
-    NativeReference* next = reinterpret_cast<ArkNativeReference*>(reference)->next_;
-
-    if (prev) {
-        reinterpret_cast<ArkNativeReference*>(prev)->next_ = next;
-    }
-    if (reference == references_) {
-        // reference is the head node.
-        references_ = next;
-    }
-    if (next) {
-        reinterpret_cast<ArkNativeReference*>(next)->prev_ = prev;
+    auto ref = reinterpret_cast<ArkNativeReference*>(reference);
+    size_t kind = static_cast<size_t>(ref->finalizerKind_);
+    if (ref->ownership_ != ReferenceOwnerShip::RUNTIME) {
+        stats_.userOwned[kind]--;
+        return;
     }
+    uint32_t index = ref->managerIndex_;
+    Slot(index) = nullptr;
+    freeSlots_.push_back(index);
+    stats_.runtimeOwned[kind]--;
+}
+
+void NativeReferenceManager::GetStats(NativeReferenceStats& stats) const
+{
+    stats = stats_;
+    stats.capacity = chunks_.size() * CHUNK_CAPACITY;
 }
@@ -16,18 +16,87 @@
 #ifndef FOUNDATION_ACE_NAPI_REFERENCE_MANAGER_NATIVE_REFERENCE_MANAGER_H
 #define FOUNDATION_ACE_NAPI_REFERENCE_MANAGER_NATIVE_REFERENCE_MANAGER_H
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
 #include "native_engine/native_reference.h"
 #include "utils/macros.h"
 
+enum class NativeReferenceFinalizer : uint8_t {
+    NONE = 0,
+    SYNC,
+    ASYNC,
+};
+
+struct NativeReferenceStats {
+    static constexpr size_t FINALIZER_KIND_COUNT = 3;
+    // live references indexed by NativeReferenceFinalizer
+    std::array<size_t, FINALIZER_KIND_COUNT> runtimeOwned {};
+    std::array<size_t, FINALIZER_KIND_COUNT> userOwned {};
+    // slots of the runtime owned storage, free ones included
+    size_t capacity = 0;
+};
+
+/*
+ * Runtime owned references are stored in chunks of CHUNK_CAPACITY slots addressed by an index kept in the
+ * reference, freed slots are reused first. Insert and remove are O(1) and teardown scans the chunks linearly
+ * instead of chasing a list through the references. User owned references are only counted.
+ */
 class NAPI_EXPORT NativeReferenceManager {
 public:
+    static constexpr size_t CHUNK_CAPACITY = 1024;
+
     NativeReferenceManager() = default;
     virtual ~NativeReferenceManager();
 
     void CreateHandler(NativeReference* reference);
     void ReleaseHandler(NativeReference* reference);
+    void GetStats(NativeReferenceStats& stats) const;
+
+private:
+    using Chunk = std::array<NativeReference*, CHUNK_CAPACITY>;
+
+    NativeReference*& Slot(uint32_t index)
+    {
+        return (*chunks_[index / CHUNK_CAPACITY])[index % CHUNK_CAPACITY];
+    }
+
+    std::vector<std::unique_ptr<Chunk>> chunks_;
+    std::vector<uint32_t> freeSlots_;
+    // slots below were handed out at least once
+    uint32_t usedSlots_ {0};
+    NativeReferenceStats stats_;
+};
+
+/*
+ * Set of user owned references resolved together, such as the observers of an event. The members are kept in one
+ * vector in insertion order, the ones whose object was collected are dropped while the group is resolved, so the
+ * group stays compact without a finalizer per member. Js thread of its engine only.
+ */
+class NativeReferenceGroup {
+public:
+    explicit NativeReferenceGroup(NativeEngine* engine) : engine_(engine) {}
+    ~NativeReferenceGroup() = default;
+
+    NativeReferenceGroup(const NativeReferenceGroup&) = delete;
+    NativeReferenceGroup& operator=(const NativeReferenceGroup&) = delete;
+
+    NativeEngine* GetEngine() const
+    {
+        return engine_;
+    }
+
+    // the members are owned by the group, whoever erases one deletes it
+    std::vector<NativeReference*>& GetReferences()
+    {
+        return references_;
+    }
 
 private:
-    NativeReference *references_ {nullptr};
+    NativeEngine* engine_;
+    std::vector<NativeReference*> references_;
 };
 #endif /* FOUNDATION_ACE_NAPI_REFERENCE_MANAGER_NATIVE_REFERENCE_MANAGER_H */
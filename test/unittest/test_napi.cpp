@@ -19,8 +19,10 @@
 #define private public
 #define protected public
 
+#include <atomic>
 #include <chrono>
 #include <thread>
+#include <vector>
 
 #include "ark_native_reference.h"
 #include "gtest/gtest.h"
@@ -8747,6 +8749,628 @@ HWTEST_F(NapiBasicTest, NapiDeleteAsyncWorkTest002, testing::ext::TestSize.Level
     ASSERT_EQ(status, napi_invalid_arg);
 }
 
+/**
+ * @tc.name: AsyncWorkPoolTest001
+ * @tc.desc: Test a deleted async work is reused by the next napi_create_async_work with the new task name.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiBasicTest, AsyncWorkPoolTest001, testing::ext::TestSize.Level1)
+{
+    napi_env env = reinterpret_cast<napi_env>(engine_);
+    napi_value firstName = nullptr;
+    napi_value secondName = nullptr;
+    ASSERT_CHECK_CALL(napi_create_string_utf8(env, TEST_CHAR_ASYNCWORK, NAPI_AUTO_LENGTH, &firstName));
+    ASSERT_CHECK_CALL(napi_create_string_utf8(env, TEST_STRING, NAPI_AUTO_LENGTH, &secondName));
+    napi_async_work_pool_stats before;
+    ASSERT_CHECK_CALL(napi_get_async_work_pool_stats(env, &before));
+
+    napi_async_work first = nullptr;
+    ASSERT_CHECK_CALL(napi_create_async_work(env, nullptr, firstName, [](napi_env env, void* data) {},
+        [](napi_env env, napi_status status, void* data) {}, nullptr, &first));
+    ASSERT_CHECK_CALL(napi_delete_async_work(env, first));
+    napi_async_work second = nullptr;
+    ASSERT_CHECK_CALL(napi_create_async_work(env, nullptr, secondName, [](napi_env env, void* data) {},
+        [](napi_env env, napi_status status, void* data) {}, nullptr, &second));
+    EXPECT_EQ(second, first);
+    EXPECT_EQ(reinterpret_cast<NativeAsyncWork*>(second)->GetTaskName(), std::string(TEST_STRING));
+
+    napi_async_work_pool_stats after;
+    ASSERT_CHECK_CALL(napi_get_async_work_pool_stats(env, &after));
+    EXPECT_EQ(after.hits + after.misses, before.hits + before.misses + 2);
+    EXPECT_GE(after.hits, before.hits + 1);
+    ASSERT_CHECK_CALL(napi_delete_async_work(env, second));
+}
+
+/**
+ * @tc.name: AsyncWorkPoolTest002
+ * @tc.desc: Test a pool capacity of 0 frees the cached async works and disables the reuse.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiBasicTest, AsyncWorkPoolTest002, testing::ext::TestSize.Level1)
+{
+    napi_env env = reinterpret_cast<napi_env>(engine_);
+    napi_value resourceName = nullptr;
+    ASSERT_CHECK_CALL(napi_create_string_utf8(env, TEST_CHAR_ASYNCWORK, NAPI_AUTO_LENGTH, &resourceName));
+    ASSERT_CHECK_CALL(napi_set_async_work_pool_capacity(env, 0));
+    napi_async_work_pool_stats stats;
+    ASSERT_CHECK_CALL(napi_get_async_work_pool_stats(env, &stats));
+    EXPECT_EQ(stats.cached, 0);
+    uint64_t hits = stats.hits;
+
+    napi_async_work work = nullptr;
+    ASSERT_CHECK_CALL(napi_create_async_work(env, nullptr, resourceName, [](napi_env env, void* data) {},
+        [](napi_env env, napi_status status, void* data) {}, nullptr, &work));
+    ASSERT_CHECK_CALL(napi_delete_async_work(env, work));
+    ASSERT_CHECK_CALL(napi_get_async_work_pool_stats(env, &stats));
+    EXPECT_EQ(stats.cached, 0);
+    EXPECT_EQ(stats.hits, hits);
+
+    ASSERT_CHECK_CALL(napi_set_async_work_pool_capacity(env, NativeAsyncWorkPool::DEFAULT_CAPACITY));
+    ASSERT_EQ(napi_get_async_work_pool_stats(env, nullptr), napi_invalid_arg);
+}
+
+/**
+ * @tc.name: AsyncWorkBatchTest001
+ * @tc.desc: Test every item of a batch runs once and the per item status reaches the single complete callback.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiBasicTest, AsyncWorkBatchTest001, testing::ext::TestSize.Level1)
+{
+    static constexpr size_t itemCount = 200;
+    static constexpr size_t failedStep = 10;
+    struct BatchContext {
+        napi_async_work_batch batch = nullptr;
+        std::atomic<size_t> executed[itemCount] {};
+        size_t completeCount = 0;
+    };
+    napi_env env = reinterpret_cast<napi_env>(engine_);
+    auto context = new BatchContext();
+    napi_value resourceName = nullptr;
+    ASSERT_CHECK_CALL(napi_create_string_utf8(env, TEST_CHAR_ASYNCWORK, NAPI_AUTO_LENGTH, &resourceName));
+    ASSERT_CHECK_CALL(napi_create_async_work_batch(env, resourceName, itemCount,
+        [](napi_env env, void* data, size_t index) {
+            auto context = reinterpret_cast<BatchContext*>(data);
+            context->executed[index].fetch_add(1);
+            return index % failedStep == 0 ? napi_generic_failure : napi_ok;
+        },
+        [](napi_env env, napi_status status, void* data, const napi_status* itemStatus, size_t count) {
+            auto context = reinterpret_cast<BatchContext*>(data);
+            context->completeCount++;
+            EXPECT_EQ(status, napi_generic_failure);
+            ASSERT_NE(itemStatus, nullptr);
+            ASSERT_EQ(count, itemCount);
+            for (size_t i = 0; i < count; ++i) {
+                EXPECT_EQ(context->executed[i].load(), 1);
+                EXPECT_EQ(itemStatus[i], i % failedStep == 0 ? napi_generic_failure : napi_ok);
+            }
+            STOP_EVENT_LOOP(env);
+        },
+        context, true, &context->batch));
+    ASSERT_CHECK_CALL(napi_queue_async_work_batch(env, context->batch, napi_qos_default));
+    EXPECT_NE(napi_queue_async_work_batch(env, context->batch, napi_qos_default), napi_ok);
+    RUN_EVENT_LOOP(env);
+    EXPECT_EQ(context->completeCount, 1);
+    ASSERT_CHECK_CALL(napi_delete_async_work_batch(env, context->batch));
+    delete context;
+}
+
+/**
+ * @tc.name: AsyncWorkBatchTest002
+ * @tc.desc: Test a completed batch can be queued again and that item_status is NULL when it is not requested.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiBasicTest, AsyncWorkBatchTest002, testing::ext::TestSize.Level1)
+{
+    struct BatchContext {
+        napi_async_work_batch batch = nullptr;
+        std::atomic<size_t> executed { 0 };
+        size_t completeCount = 0;
+    };
+    napi_env env = reinterpret_cast<napi_env>(engine_);
+    auto context = new BatchContext();
+    napi_value resourceName = nullptr;
+    ASSERT_CHECK_CALL(napi_create_string_utf8(env, TEST_CHAR_ASYNCWORK, NAPI_AUTO_LENGTH, &resourceName));
+    ASSERT_CHECK_CALL(napi_create_async_work_batch(env, resourceName, 3,
+        [](napi_env env, void* data, size_t index) {
+            reinterpret_cast<BatchContext*>(data)->executed.fetch_add(1);
+            return napi_ok;
+        },
+        [](napi_env env, napi_status status, void* data, const napi_status* itemStatus, size_t count) {
+            reinterpret_cast<BatchContext*>(data)->completeCount++;
+            EXPECT_EQ(status, napi_ok);
+            EXPECT_EQ(itemStatus, nullptr);
+            STOP_EVENT_LOOP(env);
+        },
+        context, false, &context->batch));
+    ASSERT_CHECK_CALL(napi_queue_async_work_batch(env, context->batch, napi_qos_user_initiated));
+    RUN_EVENT_LOOP(env);
+    ASSERT_CHECK_CALL(napi_queue_async_work_batch(env, context->batch, napi_qos_background));
+    RUN_EVENT_LOOP(env);
+    EXPECT_EQ(context->executed.load(), 6);
+    EXPECT_EQ(context->completeCount, 2);
+    ASSERT_CHECK_CALL(napi_delete_async_work_batch(env, context->batch));
+    delete context;
+}
+
+/**
+ * @tc.name: AsyncWorkBatchTest003
+ * @tc.desc: Test the invalid arguments of the async work batch interfaces.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiBasicTest, AsyncWorkBatchTest003, testing::ext::TestSize.Level1)
+{
+    napi_env env = reinterpret_cast<napi_env>(engine_);
+    napi_value resourceName = nullptr;
+    ASSERT_CHECK_CALL(napi_create_string_utf8(env, TEST_CHAR_ASYNCWORK, NAPI_AUTO_LENGTH, &resourceName));
+    auto execute = [](napi_env env, void* data, size_t index) { return napi_ok; };
+    auto complete = [](napi_env env, napi_status status, void* data, const napi_status* itemStatus, size_t count) {};
+    napi_async_work_batch batch = nullptr;
+    EXPECT_EQ(napi_create_async_work_batch(env, resourceName, 0, execute, complete, nullptr, false, &batch),
+        napi_invalid_arg);
+    EXPECT_EQ(napi_create_async_work_batch(env, resourceName, 1, nullptr, complete, nullptr, false, &batch),
+        napi_invalid_arg);
+    EXPECT_EQ(napi_create_async_work_batch(env, resourceName, 1, execute, nullptr, nullptr, false, &batch),
+        napi_invalid_arg);
+    EXPECT_EQ(napi_queue_async_work_batch(env, nullptr, napi_qos_default), napi_invalid_arg);
+
+    ASSERT_CHECK_CALL(napi_create_async_work_batch(env, resourceName, 1, execute, complete, nullptr, false, &batch));
+    // not queued yet
+    EXPECT_EQ(napi_cancel_async_work_batch(env, batch), napi_generic_failure);
+    ASSERT_CHECK_CALL(napi_delete_async_work_batch(env, batch));
+
+    // a batch in flight is not deleted, even once cancelled, as its started items still run
+    UVLoopRunner runner(engine_);
+    ASSERT_CHECK_CALL(napi_create_async_work_batch(env, resourceName, 1, execute, complete, nullptr, false, &batch));
+    ASSERT_CHECK_CALL(napi_queue_async_work_batch(env, batch, napi_qos_default));
+    EXPECT_EQ(napi_delete_async_work_batch(env, batch), napi_generic_failure);
+    napi_cancel_async_work_batch(env, batch);
+    EXPECT_EQ(napi_delete_async_work_batch(env, batch), napi_generic_failure);
+    runner.Run();
+    ASSERT_CHECK_CALL(napi_delete_async_work_batch(env, batch));
+}
+
+/**
+ * @tc.name: AsyncExecutorTest001
+ * @tc.desc: Test long background tasks can not take every worker away from user initiated tasks.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiBasicTest, AsyncExecutorTest001, testing::ext::TestSize.Level1)
+{
+    struct ExecutorContext {
+        std::atomic<bool> release { false };
+        std::atomic<size_t> backgroundDone { 0 };
+        std::atomic<bool> userInitiatedDone { false };
+    };
+    ExecutorContext context;
+    {
+        NativeWorkStealingExecutor executor(2);
+        ASSERT_EQ(executor.GetLaneLimit(napi_qos_background), 1);
+        for (size_t i = 0; i < executor.GetWorkerCount() + 1; ++i) {
+            ASSERT_TRUE(executor.Submit(napi_qos_background, { [](void* data) {
+                auto context = reinterpret_cast<ExecutorContext*>(data);
+                while (!context->release.load()) {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                }
+                context->backgroundDone.fetch_add(1);
+            }, &context }));
+        }
+        ASSERT_TRUE(executor.Submit(napi_qos_user_initiated, { [](void* data) {
+            reinterpret_cast<ExecutorContext*>(data)->userInitiatedDone.store(true);
+        }, &context }));
+        auto begin = std::chrono::steady_clock::now();
+        while (!context.userInitiatedDone.load() &&
+               std::chrono::steady_clock::now() - begin < std::chrono::seconds(5)) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        EXPECT_TRUE(context.userInitiatedDone.load());
+        EXPECT_EQ(context.backgroundDone.load(), 0);
+        context.release.store(true);
+    }
+    // the destructor runs the queued tasks before joining
+    EXPECT_EQ(context.backgroundDone.load(), 3);
+}
+
+/**
+ * @tc.name: AsyncExecutorTest002
+ * @tc.desc: Test async works run on an installed executor, complete on the loop thread and can be cancelled.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiBasicTest, AsyncExecutorTest002, testing::ext::TestSize.Level1)
+{
+    struct AsyncWorkContext {
+        napi_async_work work = nullptr;
+        std::atomic<bool> executed { false };
+        napi_status status = napi_generic_failure;
+    };
+    ASSERT_NE(engine_->GetAsyncCompletionChannel(), nullptr);
+    napi_env env = reinterpret_cast<napi_env>(engine_);
+    NativeAsyncExecutor* previous = engine_->GetAsyncExecutor();
+    NativeWorkStealingExecutor executor(1);
+    engine_->SetAsyncExecutor(&executor);
+
+    // keep the only worker busy so the work stays queued
+    std::atomic<bool> release { false };
+    ASSERT_TRUE(executor.Submit(napi_qos_user_initiated, { [](void* data) {
+        while (!reinterpret_cast<std::atomic<bool>*>(data)->load()) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }, &release }));
+    napi_value resourceName = nullptr;
+    ASSERT_CHECK_CALL(napi_create_string_utf8(env, TEST_CHAR_ASYNCWORK, NAPI_AUTO_LENGTH, &resourceName));
+    AsyncWorkContext cancelled;
+    AsyncWorkContext completed;
+    auto execute = [](napi_env env, void* data) {
+        reinterpret_cast<AsyncWorkContext*>(data)->executed.store(true);
+    };
+    auto complete = [](napi_env env, napi_status status, void* data) {
+        auto context = reinterpret_cast<AsyncWorkContext*>(data);
+        context->status = status;
+        napi_delete_async_work(env, context->work);
+        if (status == napi_ok) {
+            STOP_EVENT_LOOP(env);
+        }
+    };
+    ASSERT_CHECK_CALL(napi_create_async_work(env, nullptr, resourceName, execute, complete, &cancelled,
+        &cancelled.work));
+    ASSERT_CHECK_CALL(napi_create_async_work(env, nullptr, resourceName, execute, complete, &completed,
+        &completed.work));
+    ASSERT_CHECK_CALL(napi_queue_async_work_with_qos(env, cancelled.work, napi_qos_default));
+    ASSERT_CHECK_CALL(napi_queue_async_work_with_qos(env, completed.work, napi_qos_background));
+    EXPECT_TRUE(reinterpret_cast<NativeAsyncWork*>(cancelled.work)->Cancel(engine_));
+    release.store(true);
+    RUN_EVENT_LOOP(env);
+
+    EXPECT_FALSE(cancelled.executed.load());
+    EXPECT_EQ(cancelled.status, napi_cancelled);
+    EXPECT_TRUE(completed.executed.load());
+    EXPECT_EQ(completed.status, napi_ok);
+    engine_->SetAsyncExecutor(previous);
+}
+
+/**
+ * @tc.name: AsyncExecutorTest003
+ * @tc.desc: Test works queued with the same queue id run one at a time in order on the executor.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiBasicTest, AsyncExecutorTest003, testing::ext::TestSize.Level1)
+{
+    static constexpr size_t workCount = 20;
+    static constexpr uintptr_t queueId = 0x1234;
+    struct OrderedContext {
+        std::vector<size_t> order;
+        std::atomic<size_t> running { 0 };
+        std::atomic<size_t> overlapped { 0 };
+        size_t completed = 0;
+    };
+    struct OrderedWork {
+        napi_async_work work = nullptr;
+        size_t index = 0;
+        OrderedContext* context = nullptr;
+    };
+    ASSERT_NE(engine_->GetAsyncCompletionChannel(), nullptr);
+    napi_env env = reinterpret_cast<napi_env>(engine_);
+    NativeAsyncExecutor* previous = engine_->GetAsyncExecutor();
+    NativeWorkStealingExecutor executor(4);
+    engine_->SetAsyncExecutor(&executor);
+
+    napi_value resourceName = nullptr;
+    ASSERT_CHECK_CALL(napi_create_string_utf8(env, TEST_CHAR_ASYNCWORK, NAPI_AUTO_LENGTH, &resourceName));
+    OrderedContext context;
+    std::vector<OrderedWork> works(workCount);
+    for (size_t i = 0; i < workCount; ++i) {
+        works[i].index = i;
+        works[i].context = &context;
+        ASSERT_CHECK_CALL(napi_create_async_work(env, nullptr, resourceName,
+            [](napi_env env, void* data) {
+                auto work = reinterpret_cast<OrderedWork*>(data);
+                if (work->context->running.fetch_add(1) != 0) {
+                    work->context->overlapped.fetch_add(1);
+                }
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                work->context->order.push_back(work->index);
+                work->context->running.fetch_sub(1);
+            },
+            [](napi_env env, napi_status status, void* data) {
+                auto work = reinterpret_cast<OrderedWork*>(data);
+                napi_delete_async_work(env, work->work);
+                if (++work->context->completed == workCount) {
+                    STOP_EVENT_LOOP(env);
+                }
+            },
+            &works[i], &works[i].work));
+    }
+    for (size_t i = 0; i < workCount; ++i) {
+        ASSERT_CHECK_CALL(napi_queue_async_work_with_queue(env, works[i].work,
+            i % 2 == 0 ? napi_qos_background : napi_qos_user_initiated, queueId));
+    }
+    RUN_EVENT_LOOP(env);
+
+    EXPECT_EQ(context.overlapped.load(), 0);
+    ASSERT_EQ(context.order.size(), workCount);
+    for (size_t i = 0; i < workCount; ++i) {
+        EXPECT_EQ(context.order[i], i);
+    }
+    // the queue is dropped right after its last task returned
+    auto begin = std::chrono::steady_clock::now();
+    while (executor.GetActiveSerialQueueCount() != 0 &&
+           std::chrono::steady_clock::now() - begin < std::chrono::seconds(1)) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_EQ(executor.GetActiveSerialQueueCount(), 0);
+    engine_->SetAsyncExecutor(previous);
+}
+
+/**
+ * @tc.name: AsyncExecutorTest004
+ * @tc.desc: Test the work stealing executor is only used once an env opts in.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiBasicTest, AsyncExecutorTest004, testing::ext::TestSize.Level1)
+{
+    ASSERT_NE(engine_->GetAsyncCompletionChannel(), nullptr);
+    napi_env env = reinterpret_cast<napi_env>(engine_);
+    NativeAsyncExecutor* previous = engine_->GetAsyncExecutor();
+    ASSERT_EQ(previous, nullptr);
+
+    ASSERT_CHECK_CALL(napi_set_work_stealing_executor_enabled(env, true));
+    EXPECT_EQ(engine_->GetAsyncExecutor(), NativeWorkStealingExecutor::GetInstance());
+    ASSERT_CHECK_CALL(napi_set_work_stealing_executor_enabled(env, false));
+    EXPECT_EQ(engine_->GetAsyncExecutor(), nullptr);
+    EXPECT_EQ(napi_set_work_stealing_executor_enabled(nullptr, true), napi_invalid_arg);
+}
+
+/**
+ * @tc.name: AsyncWorkCancelTokenTest001
+ * @tc.desc: Test requesting the cancel of a running async work flips the cancel token and reports napi_cancelled,
+ *           while napi_cancel_async_work leaves a running work alone.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiBasicTest, AsyncWorkCancelTokenTest001, testing::ext::TestSize.Level1)
+{
+    struct CancelContext {
+        napi_async_work work = nullptr;
+        std::atomic<bool> started { false };
+        std::atomic<bool> observed { false };
+        napi_status status = napi_ok;
+    };
+    napi_env env = reinterpret_cast<napi_env>(engine_);
+    bool requested = true;
+    ASSERT_EQ(napi_is_async_work_cancel_requested(nullptr, &requested), napi_invalid_arg);
+
+    napi_value resourceName = nullptr;
+    ASSERT_CHECK_CALL(napi_create_string_utf8(env, TEST_CHAR_ASYNCWORK, NAPI_AUTO_LENGTH, &resourceName));
+    CancelContext context;
+    ASSERT_CHECK_CALL(napi_create_async_work(env, nullptr, resourceName,
+        [](napi_env env, void* data) {
+            auto context = reinterpret_cast<CancelContext*>(data);
+            context->started.store(true);
+            auto begin = std::chrono::steady_clock::now();
+            while (std::chrono::steady_clock::now() - begin < std::chrono::seconds(5)) {
+                bool cancelled = false;
+                napi_is_async_work_cancel_requested(context->work, &cancelled);
+                if (cancelled) {
+                    context->observed.store(true);
+                    return;
+                }
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        },
+        [](napi_env env, napi_status status, void* data) {
+            auto context = reinterpret_cast<CancelContext*>(data);
+            context->status = status;
+            napi_delete_async_work(env, context->work);
+            STOP_EVENT_LOOP(env);
+        },
+        &context, &context.work));
+    ASSERT_CHECK_CALL(napi_is_async_work_cancel_requested(context.work, &requested));
+    EXPECT_FALSE(requested);
+    ASSERT_CHECK_CALL(napi_queue_async_work(env, context.work));
+    while (!context.started.load()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    napi_cancel_async_work(env, context.work);
+    ASSERT_CHECK_CALL(napi_is_async_work_cancel_requested(context.work, &requested));
+    EXPECT_FALSE(requested);
+    ASSERT_CHECK_CALL(napi_request_async_work_cancel(env, context.work));
+    RUN_EVENT_LOOP(env);
+
+    EXPECT_TRUE(context.observed.load());
+    EXPECT_EQ(context.status, napi_cancelled);
+}
+
+/**
+ * @tc.name: AsyncWorkCancelTokenTest002
+ * @tc.desc: Test a cancel requested after execute returned fails and the complete callback gets napi_ok.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiBasicTest, AsyncWorkCancelTokenTest002, testing::ext::TestSize.Level1)
+{
+    struct CancelContext {
+        napi_async_work work = nullptr;
+        std::atomic<bool> executed { false };
+        napi_status status = napi_generic_failure;
+    };
+    napi_env env = reinterpret_cast<napi_env>(engine_);
+    napi_value resourceName = nullptr;
+    ASSERT_CHECK_CALL(napi_create_string_utf8(env, TEST_CHAR_ASYNCWORK, NAPI_AUTO_LENGTH, &resourceName));
+    CancelContext context;
+    ASSERT_CHECK_CALL(napi_create_async_work(env, nullptr, resourceName,
+        [](napi_env env, void* data) {
+            reinterpret_cast<CancelContext*>(data)->executed.store(true);
+        },
+        [](napi_env env, napi_status status, void* data) {
+            auto context = reinterpret_cast<CancelContext*>(data);
+            context->status = status;
+            napi_delete_async_work(env, context->work);
+            STOP_EVENT_LOOP(env);
+        },
+        &context, &context.work));
+    ASSERT_EQ(napi_request_async_work_cancel(env, nullptr), napi_invalid_arg);
+    ASSERT_CHECK_CALL(napi_queue_async_work(env, context.work));
+    while (!context.executed.load()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    // execute returned, only its completion is pending on the loop
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    EXPECT_EQ(napi_request_async_work_cancel(env, context.work), napi_generic_failure);
+    RUN_EVENT_LOOP(env);
+
+    EXPECT_EQ(context.status, napi_ok);
+}
+
+/**
+ * @tc.name: TaskLatencyTest001
+ * @tc.desc: Test the queue wait, execute and complete latency of an async work is recorded by name.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiBasicTest, TaskLatencyTest001, testing::ext::TestSize.Level1)
+{
+    static constexpr const char latencyName[] = "TaskLatencyTest";
+    struct LatencyContext {
+        napi_async_work work = nullptr;
+    };
+    napi_env env = reinterpret_cast<napi_env>(engine_);
+    ASSERT_CHECK_CALL(napi_reset_task_latency(env));
+    ASSERT_CHECK_CALL(napi_set_task_latency_enabled(env, true));
+
+    napi_value resourceName = nullptr;
+    ASSERT_CHECK_CALL(napi_create_string_utf8(env, latencyName, NAPI_AUTO_LENGTH, &resourceName));
+    LatencyContext context;
+    ASSERT_CHECK_CALL(napi_create_async_work(env, nullptr, resourceName,
+        [](napi_env env, void* data) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        },
+        [](napi_env env, napi_status status, void* data) {
+            auto context = reinterpret_cast<LatencyContext*>(data);
+            napi_delete_async_work(env, context->work);
+            STOP_EVENT_LOOP(env);
+        },
+        &context, &context.work));
+    ASSERT_CHECK_CALL(napi_queue_async_work(env, context.work));
+    RUN_EVENT_LOOP(env);
+    ASSERT_CHECK_CALL(napi_set_task_latency_enabled(env, false));
+
+    napi_task_latency_stats stats;
+    ASSERT_CHECK_CALL(napi_get_task_latency_stats(env, latencyName, napi_task_latency_execute, &stats));
+    EXPECT_EQ(stats.count, 1);
+    EXPECT_GE(stats.max_us, 2000);
+    EXPECT_LE(stats.p50_us, stats.max_us);
+    ASSERT_CHECK_CALL(napi_get_task_latency_stats(env, latencyName, napi_task_latency_queue_wait, &stats));
+    EXPECT_EQ(stats.count, 1);
+    ASSERT_CHECK_CALL(napi_get_task_latency_stats(env, latencyName, napi_task_latency_complete, &stats));
+    EXPECT_EQ(stats.count, 1);
+    ASSERT_CHECK_CALL(napi_get_task_latency_stats(env, latencyName, napi_task_latency_call_js, &stats));
+    EXPECT_EQ(stats.count, 0);
+
+    size_t length = 0;
+    ASSERT_CHECK_CALL(napi_dump_task_latency(env, nullptr, 0, &length));
+    std::vector<char> json(length + 1);
+    size_t copied = 0;
+    ASSERT_CHECK_CALL(napi_dump_task_latency(env, json.data(), json.size(), &copied));
+    EXPECT_EQ(copied, length);
+    EXPECT_NE(std::string(json.data()).find("\"name\":\"TaskLatencyTest\""), std::string::npos);
+    ASSERT_CHECK_CALL(napi_reset_task_latency(env));
+}
+
+/**
+ * @tc.name: ReferenceSlabTest001
+ * @tc.desc: Test references are allocated from the slab of the engine and their slots are reused.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiBasicTest, ReferenceSlabTest001, testing::ext::TestSize.Level1)
+{
+    static constexpr size_t refCount = 1000;
+    napi_env env = reinterpret_cast<napi_env>(engine_);
+    napi_reference_slab_stats before;
+    ASSERT_CHECK_CALL(napi_get_reference_slab_stats(env, &before));
+
+    napi_value object = nullptr;
+    ASSERT_CHECK_CALL(napi_create_object(env, &object));
+    std::vector<napi_ref> refs(refCount);
+    for (size_t i = 0; i < refCount; ++i) {
+        ASSERT_CHECK_CALL(napi_create_reference(env, object, 1, &refs[i]));
+    }
+    napi_reference_slab_stats stats;
+    ASSERT_CHECK_CALL(napi_get_reference_slab_stats(env, &stats));
+    EXPECT_EQ(stats.live_objects, before.live_objects + refCount);
+    EXPECT_EQ(stats.allocations, before.allocations + refCount);
+    EXPECT_GT(stats.chunks, 0);
+    EXPECT_EQ(stats.reserved_bytes, stats.chunks * NativeSlabAllocator::CHUNK_SIZE);
+    size_t peakChunks = stats.chunks;
+
+    for (size_t i = 0; i < refCount; ++i) {
+        ASSERT_CHECK_CALL(napi_delete_reference(env, refs[i]));
+    }
+    ASSERT_CHECK_CALL(napi_get_reference_slab_stats(env, &stats));
+    EXPECT_EQ(stats.live_objects, before.live_objects);
+    EXPECT_EQ(stats.frees, before.frees + refCount);
+
+    // the same number of references fits in as many chunks again
+    for (size_t i = 0; i < refCount; ++i) {
+        ASSERT_CHECK_CALL(napi_create_reference(env, object, 1, &refs[i]));
+    }
+    ASSERT_CHECK_CALL(napi_get_reference_slab_stats(env, &stats));
+    EXPECT_LE(stats.chunks, peakChunks);
+    for (size_t i = 0; i < refCount; ++i) {
+        ASSERT_CHECK_CALL(napi_delete_reference(env, refs[i]));
+    }
+}
+
+/**
+ * @tc.name: ReferenceStatsTest001
+ * @tc.desc: Test live references are counted by ownership and finalizer and runtime slots are reused.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiBasicTest, ReferenceStatsTest001, testing::ext::TestSize.Level1)
+{
+    static constexpr size_t objectCount = NativeReferenceManager::CHUNK_CAPACITY + 1;
+    napi_env env = reinterpret_cast<napi_env>(engine_);
+    napi_reference_stats before;
+    ASSERT_CHECK_CALL(napi_get_reference_stats(env, &before));
+
+    napi_value object = nullptr;
+    ASSERT_CHECK_CALL(napi_create_object(env, &object));
+    napi_ref userRef = nullptr;
+    ASSERT_CHECK_CALL(napi_create_reference(env, object, 1, &userRef));
+    napi_reference_stats stats;
+    ASSERT_CHECK_CALL(napi_get_reference_stats(env, &stats));
+    EXPECT_EQ(stats.user_no_finalizer, before.user_no_finalizer + 1);
+
+    // wraps without a result are owned by the runtime and finalized synchronously
+    std::vector<napi_value> objects(objectCount);
+    for (size_t i = 0; i < objectCount; ++i) {
+        ASSERT_CHECK_CALL(napi_create_object(env, &objects[i]));
+        ASSERT_CHECK_CALL(napi_wrap(env, objects[i], &stats, [](napi_env, void*, void*) {}, nullptr, nullptr));
+    }
+    ASSERT_CHECK_CALL(napi_get_reference_stats(env, &stats));
+    EXPECT_EQ(stats.runtime_sync_finalizer, before.runtime_sync_finalizer + objectCount);
+    EXPECT_GE(stats.tracked_capacity, before.runtime_sync_finalizer + objectCount);
+    size_t peakCapacity = stats.tracked_capacity;
+
+    for (size_t i = 0; i < objectCount; ++i) {
+        void* result = nullptr;
+        ASSERT_CHECK_CALL(napi_remove_wrap(env, objects[i], &result));
+    }
+    ASSERT_CHECK_CALL(napi_get_reference_stats(env, &stats));
+    EXPECT_EQ(stats.runtime_sync_finalizer, before.runtime_sync_finalizer);
+
+    // freed slots are taken again before the storage grows
+    for (size_t i = 0; i < objectCount; ++i) {
+        ASSERT_CHECK_CALL(napi_wrap(env, objects[i], &stats, [](napi_env, void*, void*) {}, nullptr, nullptr));
+    }
+    ASSERT_CHECK_CALL(napi_get_reference_stats(env, &stats));
+    EXPECT_EQ(stats.tracked_capacity, peakCapacity);
+    for (size_t i = 0; i < objectCount; ++i) {
+        void* result = nullptr;
+        ASSERT_CHECK_CALL(napi_remove_wrap(env, objects[i], &result));
+    }
+
+    ASSERT_CHECK_CALL(napi_delete_reference(env, userRef));
+    ASSERT_CHECK_CALL(napi_get_reference_stats(env, &stats));
+    EXPECT_EQ(stats.user_no_finalizer, before.user_no_finalizer);
+    ASSERT_EQ(napi_get_reference_stats(env, nullptr), napi_invalid_arg);
+}
+
 HWTEST_F(NapiBasicTest, NapiQueueAsyncWorkTest001, testing::ext::TestSize.Level1)
 {
     napi_env env = reinterpret_cast<napi_env>(engine_);
@@ -10014,6 +10638,30 @@ HWTEST_F(NapiBasicTest, NapiCallThreadsafeFunctionWithPriorityTest001, testing::
     ASSERT_EQ(status, napi_invalid_arg);
 }
 
+/**
+ * @tc.name: NapiCallThreadsafeFunctionWithPriorityTest002
+ * @tc.desc: Test a call with priority on a closing tsfn releases the calling thread like a plain call.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiBasicTest, NapiCallThreadsafeFunctionWithPriorityTest002, testing::ext::TestSize.Level1)
+{
+    UVLoopRunner runner(engine_);
+    napi_env env = reinterpret_cast<napi_env>(engine_);
+    napi_value resourceName = nullptr;
+    ASSERT_CHECK_CALL(napi_create_string_utf8(env, __func__, NAPI_AUTO_LENGTH, &resourceName));
+    napi_threadsafe_function tsfn = nullptr;
+    ASSERT_CHECK_CALL(napi_create_threadsafe_function(env, nullptr, nullptr, resourceName, 0, 3, nullptr, nullptr,
+        nullptr, [](napi_env, napi_value, void*, void*) {}, &tsfn));
+    ASSERT_CHECK_CALL(napi_release_threadsafe_function(tsfn, napi_tsfn_abort));
+
+    // the abort released one of the three threads, each closed call releases one of the two left
+    ASSERT_EQ(napi_call_threadsafe_function_with_priority(tsfn, nullptr, napi_priority_idle, true), napi_closing);
+    ASSERT_EQ(napi_call_threadsafe_function(tsfn, nullptr, napi_tsfn_nonblocking), napi_closing);
+    ASSERT_EQ(napi_call_threadsafe_function_with_priority(tsfn, nullptr, napi_priority_idle, true),
+        napi_invalid_arg);
+    runner.Run();
+}
+
 HWTEST_F(NapiBasicTest, NapiIsSendableTest001, testing::ext::TestSize.Level1)
 {
     napi_env env = reinterpret_cast<napi_env>(engine_);
@@ -14951,6 +15599,9 @@ HWTEST_F(NapiBasicTest, ArkNativeReferenceTest004, testing::ext::TestSize.Level1
         panda::LocalScope scope(engine_->GetEcmaVm());
         napi_value value = nullptr;
         ASSERT_CHECK_CALL(napi_create_object(env, &value));
+        NativeReferenceManager* manager = engine_->GetReferenceManager();
+        NativeReferenceStats before;
+        manager->GetStats(before);
         ASSERT_CHECK_CALL(napi_add_finalizer(
             env, value, ref,
             // This callback is execution under deconstructor of ArkNativeReference
@@ -14958,8 +15609,18 @@ HWTEST_F(NapiBasicTest, ArkNativeReferenceTest004, testing::ext::TestSize.Level1
                 *reinterpret_cast<ArkNativeReference**>(data) = nullptr;
             },
             nullptr, nullptr));
-        // Head is last reference which created above. 
-        *ref = reinterpret_cast<ArkNativeReference*>(engine_->GetReferenceManager()->references_);
+        NativeReferenceStats after;
+        manager->GetStats(after);
+        size_t sync = static_cast<size_t>(NativeReferenceFinalizer::SYNC);
+        ASSERT_EQ(after.runtimeOwned[sync], before.runtimeOwned[sync] + 1);
+        // The reference created above is the runtime owned one holding ref as its data.
+        for (uint32_t slot = 0; slot < manager->usedSlots_ && *ref == nullptr; ++slot) {
+            NativeReference* reference = manager->Slot(slot);
+            if (reference != nullptr && reference->GetData() == ref) {
+                *ref = reinterpret_cast<ArkNativeReference*>(reference);
+            }
+        }
+        ASSERT_NE(*ref, nullptr);
         ASSERT_NE((*ref)->properties_ & ArkNativeReference::DELETE_SELF_MASK, 0);
         ASSERT_EQ((*ref)->properties_ & ArkNativeReference::IS_ASYNC_CALL_MASK, 0);
         ASSERT_EQ((*ref)->properties_ & ArkNativeReference::HAS_DELETE_MASK, 0);
@@ -15006,6 +15667,683 @@ HWTEST_F(NapiBasicTest, ArkNativeReferenceTest005, testing::ext::TestSize.Level1
     delete testData;
 }
 
+/**
+ * @tc.name: AsyncFinalizerTest001
+ * @tc.desc: Test finalizers added by napi_add_async_finalizer run off the js thread without env.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiBasicTest, AsyncFinalizerTest001, testing::ext::TestSize.Level1)
+{
+    static constexpr size_t objectCount = ArkNativeEngine::MIN_ASYNC_FINALIZERS_PER_TASK * 2;
+    struct FinalizeState {
+        std::atomic<size_t> finalized { 0 };
+        std::atomic<size_t> withEnv { 0 };
+        std::atomic<size_t> onJsThread { 0 };
+        std::thread::id jsThread = std::this_thread::get_id();
+    };
+    UVLoopRunner runner(engine_);
+    napi_env env = reinterpret_cast<napi_env>(engine_);
+    FinalizeState state;
+    {
+        panda::LocalScope scope(engine_->GetEcmaVm());
+        for (size_t i = 0; i < objectCount; ++i) {
+            napi_value object = nullptr;
+            ASSERT_CHECK_CALL(napi_create_object(env, &object));
+            ASSERT_CHECK_CALL(napi_add_async_finalizer(env, object, nullptr, [](napi_env env, void*, void* hint) {
+                auto finalizeState = reinterpret_cast<FinalizeState*>(hint);
+                if (env != nullptr) {
+                    finalizeState->withEnv++;
+                }
+                if (std::this_thread::get_id() == finalizeState->jsThread) {
+                    finalizeState->onJsThread++;
+                }
+                finalizeState->finalized++;
+            }, &state, nullptr));
+        }
+    }
+    panda::JSNApi::TriggerGC(engine_->GetEcmaVm(), panda::ecmascript::GCReason::OTHER,
+                             panda::JSNApi::TRIGGER_GC_TYPE::FULL_GC);
+    runner.Run();
+    for (size_t retry = 0; retry < 100 && state.finalized < objectCount; ++retry) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    EXPECT_EQ(state.finalized, objectCount);
+    EXPECT_EQ(state.withEnv, 0);
+    EXPECT_EQ(state.onJsThread, 0);
+    ASSERT_EQ(napi_add_async_finalizer(env, nullptr, nullptr, nullptr, nullptr, nullptr), napi_invalid_arg);
+}
+
+/**
+ * @tc.name: AsyncFinalizerQueueTest001
+ * @tc.desc: Test small async finalizer flushes join a queued task, large ones are split and tasks are reused.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiBasicTest, AsyncFinalizerQueueTest001, testing::ext::TestSize.Level1)
+{
+    static constexpr size_t flushSize = 10;
+    class HoldingExecutor : public NativeAsyncExecutor {
+    public:
+        bool Submit(napi_qos_t qos, NativeAsyncTask task) override
+        {
+            tasks.push_back(task);
+            return true;
+        }
+        void RunAll()
+        {
+            for (auto& task : tasks) {
+                task.run(task.data);
+            }
+            tasks.clear();
+        }
+        std::vector<NativeAsyncTask> tasks;
+    };
+    auto finalizeCb = [](napi_env, void* data, void*) {
+        (*reinterpret_cast<size_t*>(data))++;
+    };
+    size_t finalized = 0;
+    auto flush = [&finalized, finalizeCb](size_t count) {
+        return std::vector<RefAsyncFinalizer>(count, { finalizeCb, { &finalized, nullptr } });
+    };
+    HoldingExecutor executor;
+    auto queue = new ArkAsyncFinalizerQueue([](std::vector<RefAsyncFinalizer>* finalizers) {
+        for (auto& finalizer : *finalizers) {
+            finalizer.first(nullptr, finalizer.second.first, finalizer.second.second);
+        }
+    });
+
+    std::vector<RefAsyncFinalizer> pending = flush(flushSize);
+    queue->Post(nullptr, &executor, pending);
+    EXPECT_TRUE(pending.empty());
+    pending = flush(flushSize);
+    queue->Post(nullptr, &executor, pending);
+    ASSERT_EQ(executor.tasks.size(), 1);
+    EXPECT_EQ(queue->GetQueuedTaskCount(), 1);
+    executor.RunAll();
+    EXPECT_EQ(finalized, flushSize * 2);
+    EXPECT_EQ(queue->GetQueuedTaskCount(), 0);
+    EXPECT_EQ(queue->GetIdleTaskCount(), 1);
+
+    // a large flush is split, the idle task is taken first, and does not join a queued task
+    static constexpr size_t largeFlushSize =
+        ArkAsyncFinalizerQueue::MIN_FINALIZERS_PER_TASK * ArkAsyncFinalizerQueue::MAX_TASKS_PER_POST * 2;
+    pending = flush(largeFlushSize);
+    queue->Post(nullptr, &executor, pending);
+    ASSERT_EQ(executor.tasks.size(), ArkAsyncFinalizerQueue::MAX_TASKS_PER_POST);
+    EXPECT_EQ(queue->GetIdleTaskCount(), 0);
+    pending = flush(largeFlushSize);
+    queue->Post(nullptr, &executor, pending);
+    ASSERT_EQ(executor.tasks.size(), ArkAsyncFinalizerQueue::MAX_TASKS_PER_POST * 2);
+    executor.RunAll();
+    EXPECT_EQ(queue->GetIdleTaskCount(), ArkAsyncFinalizerQueue::MAX_IDLE_TASKS);
+    EXPECT_EQ(finalized, flushSize * 2 + largeFlushSize * 2);
+
+    // a task still running when the queue is detached takes it down with it
+    pending = flush(flushSize);
+    queue->Post(nullptr, &executor, pending);
+    queue->Detach();
+    executor.RunAll();
+}
+
+/**
+ * @tc.name: FinalizerSliceTest001
+ * @tc.desc: Test finalizers of a large gc run in slices to the end and their wait time is recorded.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiBasicTest, FinalizerSliceTest001, testing::ext::TestSize.Level1)
+{
+    static constexpr size_t objectCount = ArkFinalizersPack::SLICE_CHECK_INTERVAL * 100;
+    UVLoopRunner runner(engine_);
+    napi_env env = reinterpret_cast<napi_env>(engine_);
+    napi_finalizer_stats before;
+    ASSERT_CHECK_CALL(napi_get_finalizer_stats(env, &before));
+    size_t finalized = 0;
+    {
+        panda::LocalScope scope(engine_->GetEcmaVm());
+        for (size_t i = 0; i < objectCount; ++i) {
+            napi_value object = nullptr;
+            ASSERT_CHECK_CALL(napi_create_object(env, &object));
+            ASSERT_CHECK_CALL(napi_add_finalizer(env, object, &finalized, [](napi_env, void* data, void*) {
+                (*reinterpret_cast<size_t*>(data))++;
+            }, nullptr, nullptr));
+        }
+    }
+    panda::JSNApi::TriggerGC(engine_->GetEcmaVm(), panda::ecmascript::GCReason::OTHER,
+                             panda::JSNApi::TRIGGER_GC_TYPE::FULL_GC);
+    runner.Run();
+    EXPECT_EQ(finalized, objectCount);
+    napi_finalizer_stats stats;
+    ASSERT_CHECK_CALL(napi_get_finalizer_stats(env, &stats));
+    EXPECT_EQ(stats.pending_finalizers, 0);
+    EXPECT_EQ(stats.pending_native_binding_size, before.pending_native_binding_size);
+    EXPECT_GE(stats.wait.count, before.wait.count + objectCount);
+    EXPECT_LE(stats.wait.p50_us, stats.wait.max_us);
+    ASSERT_EQ(napi_get_finalizer_stats(env, nullptr), napi_invalid_arg);
+}
+
+/**
+ * @tc.name: FinalizerProfileTest001
+ * @tc.desc: Test finalizer callbacks are timed when profiling is on and dumped as top lists.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiBasicTest, FinalizerProfileTest001, testing::ext::TestSize.Level1)
+{
+    static constexpr size_t objectCount = 100;
+    static constexpr size_t topCount = 16;
+    UVLoopRunner runner(engine_);
+    napi_env env = reinterpret_cast<napi_env>(engine_);
+    ASSERT_CHECK_CALL(napi_reset_finalizer_profile(env));
+    ASSERT_CHECK_CALL(napi_set_finalizer_profiling_enabled(env, true));
+    size_t finalized = 0;
+    {
+        panda::LocalScope scope(engine_->GetEcmaVm());
+        for (size_t i = 0; i < objectCount; ++i) {
+            napi_value object = nullptr;
+            ASSERT_CHECK_CALL(napi_create_object(env, &object));
+            ASSERT_CHECK_CALL(napi_add_finalizer(env, object, &finalized, [](napi_env, void* data, void*) {
+                (*reinterpret_cast<size_t*>(data))++;
+            }, nullptr, nullptr));
+        }
+    }
+    panda::JSNApi::TriggerGC(engine_->GetEcmaVm(), panda::ecmascript::GCReason::OTHER,
+                             panda::JSNApi::TRIGGER_GC_TYPE::FULL_GC);
+    runner.Run();
+    ASSERT_CHECK_CALL(napi_set_finalizer_profiling_enabled(env, false));
+    ASSERT_EQ(finalized, objectCount);
+
+    size_t length = 0;
+    ASSERT_CHECK_CALL(napi_dump_finalizer_profile(env, topCount, nullptr, 0, &length));
+    std::string json(length + 1, '\0');
+    size_t copied = 0;
+    ASSERT_CHECK_CALL(napi_dump_finalizer_profile(env, topCount, json.data(), json.size(), &copied));
+    ASSERT_EQ(copied, length);
+    json.resize(copied);
+    EXPECT_NE(json.find("\"mostFrequent\":[{"), std::string::npos);
+    EXPECT_NE(json.find("\"count\":" + std::to_string(objectCount) + ","), std::string::npos);
+
+    ASSERT_CHECK_CALL(napi_reset_finalizer_profile(env));
+    ASSERT_CHECK_CALL(napi_dump_finalizer_profile(env, topCount, json.data(), json.size(), &copied));
+    EXPECT_EQ(std::string(json.data(), copied), "{\"dropped\":0,\"slowest\":[],\"mostFrequent\":[]}");
+    ASSERT_EQ(napi_dump_finalizer_profile(env, topCount, nullptr, 0, nullptr), napi_invalid_arg);
+}
+
+/**
+ * @tc.name: ReferenceSamplingTest001
+ * @tc.desc: Test sampled references count live at their creation site until they are deleted.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiBasicTest, ReferenceSamplingTest001, testing::ext::TestSize.Level1)
+{
+    static constexpr size_t refCount = 10;
+    static constexpr size_t deleteCount = 4;
+    static constexpr size_t topCount = 4;
+    napi_env env = reinterpret_cast<napi_env>(engine_);
+    napi_value object = nullptr;
+    ASSERT_CHECK_CALL(napi_create_object(env, &object));
+    ASSERT_CHECK_CALL(napi_set_reference_sampling_interval(env, 1));
+    std::vector<napi_ref> refs(refCount);
+    for (size_t i = 0; i < refCount; ++i) {
+        ASSERT_CHECK_CALL(napi_create_reference(env, object, 1, &refs[i]));
+    }
+    for (size_t i = 0; i < deleteCount; ++i) {
+        ASSERT_CHECK_CALL(napi_delete_reference(env, refs[i]));
+    }
+    ASSERT_CHECK_CALL(napi_set_reference_sampling_interval(env, 0));
+
+    size_t length = 0;
+    ASSERT_CHECK_CALL(napi_dump_reference_sites(env, topCount, nullptr, 0, &length));
+    std::string json(length + 1, '\0');
+    size_t copied = 0;
+    ASSERT_CHECK_CALL(napi_dump_reference_sites(env, topCount, json.data(), json.size(), &copied));
+    json.resize(copied);
+    EXPECT_NE(json.find("\"live\":" + std::to_string(refCount - deleteCount) + ",\"total\":" +
+                        std::to_string(refCount)), std::string::npos);
+
+    for (size_t i = deleteCount; i < refCount; ++i) {
+        ASSERT_CHECK_CALL(napi_delete_reference(env, refs[i]));
+    }
+    ASSERT_CHECK_CALL(napi_dump_reference_sites(env, topCount, nullptr, 0, &length));
+    json.assign(length + 1, '\0');
+    ASSERT_CHECK_CALL(napi_dump_reference_sites(env, topCount, json.data(), json.size(), &copied));
+    EXPECT_NE(std::string(json.data(), copied).find("\"sites\":[]"), std::string::npos);
+    ASSERT_EQ(napi_dump_reference_sites(env, topCount, nullptr, 0, nullptr), napi_invalid_arg);
+}
+
+/**
+ * @tc.name: DirectWrapTest001
+ * @tc.desc: Test wraps stored on the wrapped object unwrap, remove and finalize like wrapper object ones.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiBasicTest, DirectWrapTest001, testing::ext::TestSize.Level1)
+{
+    static constexpr size_t objectCount = 100;
+    UVLoopRunner runner(engine_);
+    napi_env env = reinterpret_cast<napi_env>(engine_);
+    auto finalizeCb = [](napi_env, void* data, void*) {
+        (*reinterpret_cast<size_t*>(data))++;
+    };
+    size_t finalized = 0;
+    size_t otherData = 0;
+    void* result = nullptr;
+    napi_value legacy = nullptr;
+    ASSERT_CHECK_CALL(napi_create_object(env, &legacy));
+    ASSERT_CHECK_CALL(napi_wrap(env, legacy, &otherData, finalizeCb, nullptr, nullptr));
+
+    ASSERT_CHECK_CALL(napi_set_direct_wrap_enabled(env, true));
+    {
+        panda::LocalScope scope(engine_->GetEcmaVm());
+        for (size_t i = 0; i < objectCount; ++i) {
+            napi_value object = nullptr;
+            ASSERT_CHECK_CALL(napi_create_object(env, &object));
+            ASSERT_CHECK_CALL(napi_wrap(env, object, &finalized, finalizeCb, nullptr, nullptr));
+            ASSERT_CHECK_CALL(napi_unwrap(env, object, &result));
+            ASSERT_EQ(result, &finalized);
+        }
+    }
+    // an object wrapped by a wrapper object keeps it
+    ASSERT_CHECK_CALL(napi_wrap(env, legacy, &finalized, finalizeCb, nullptr, nullptr));
+    ASSERT_CHECK_CALL(napi_remove_wrap(env, legacy, &result));
+    ASSERT_EQ(result, &finalized);
+
+    auto func = [](napi_env env, napi_callback_info info) -> napi_value {
+        return nullptr;
+    };
+    napi_value function = nullptr;
+    ASSERT_CHECK_CALL(napi_create_function(env, "testFunc", NAPI_AUTO_LENGTH, func, nullptr, &function));
+    ASSERT_CHECK_CALL(napi_wrap_with_size(env, function, &otherData, finalizeCb, nullptr, nullptr, 0));
+    ASSERT_CHECK_CALL(napi_wrap_with_size(env, function, &finalized, finalizeCb, nullptr, nullptr, 0));
+    ASSERT_CHECK_CALL(napi_unwrap(env, function, &result));
+    ASSERT_EQ(result, &finalized);
+    ASSERT_CHECK_CALL(napi_remove_wrap(env, function, &result));
+    ASSERT_EQ(result, &finalized);
+    ASSERT_CHECK_CALL(napi_unwrap(env, function, &result));
+    ASSERT_EQ(result, nullptr);
+    ASSERT_CHECK_CALL(napi_wrap(env, function, &otherData, finalizeCb, nullptr, nullptr));
+    ASSERT_CHECK_CALL(napi_unwrap(env, function, &result));
+    ASSERT_EQ(result, &otherData);
+
+    // an object wrapped in place is wrapped for the type tagged wraps too, and is removed only once
+    napi_value object = nullptr;
+    const napi_type_tag typeTag = { 0x1234, 0x5678 };
+    ASSERT_CHECK_CALL(napi_create_object(env, &object));
+    ASSERT_CHECK_CALL(napi_wrap(env, object, &otherData, finalizeCb, nullptr, nullptr));
+    ASSERT_EQ(napi_wrap_s(env, object, &otherData, finalizeCb, nullptr, &typeTag, nullptr), napi_invalid_arg);
+    ASSERT_EQ(napi_wrap_enhance_s(env, object, &otherData, finalizeCb, false, nullptr, 0, &typeTag, nullptr),
+              napi_invalid_arg);
+    ASSERT_CHECK_CALL(napi_remove_wrap(env, object, &result));
+    ASSERT_EQ(result, &otherData);
+    ASSERT_EQ(napi_remove_wrap(env, object, &result), napi_invalid_arg);
+    ASSERT_EQ(result, nullptr);
+    ASSERT_CHECK_CALL(napi_set_direct_wrap_enabled(env, false));
+
+    panda::JSNApi::TriggerGC(engine_->GetEcmaVm(), panda::ecmascript::GCReason::OTHER,
+                             panda::JSNApi::TRIGGER_GC_TYPE::FULL_GC);
+    runner.Run();
+    EXPECT_EQ(finalized, objectCount);
+}
+
+/**
+ * @tc.name: TypeTagUnwrapTest001
+ * @tc.desc: Test type tags stored in place and as a property are checked and unwrapped in one call.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiBasicTest, TypeTagUnwrapTest001, testing::ext::TestSize.Level1)
+{
+    napi_env env = reinterpret_cast<napi_env>(engine_);
+    auto finalizeCb = [](napi_env, void*, void*) {};
+    napi_type_tag typeTag = { 0x1234, 0x5678 };
+    const napi_type_tag otherTag = { 0x1234, 0x5679 };
+    size_t data = 0;
+    void* result = nullptr;
+    bool tagged = false;
+    for (bool directWrap : { true, false }) {
+        ASSERT_CHECK_CALL(napi_set_direct_wrap_enabled(env, directWrap));
+        napi_value tagFirst = nullptr;
+        napi_value wrapFirst = nullptr;
+        ASSERT_CHECK_CALL(napi_create_object(env, &tagFirst));
+        ASSERT_CHECK_CALL(napi_create_object(env, &wrapFirst));
+        ASSERT_CHECK_CALL(napi_type_tag_object(env, tagFirst, &typeTag));
+        ASSERT_CHECK_CALL(napi_unwrap_with_type_tag(env, tagFirst, &typeTag, &result));
+        ASSERT_EQ(result, nullptr);
+        ASSERT_CHECK_CALL(napi_wrap(env, tagFirst, &data, finalizeCb, nullptr, nullptr));
+        ASSERT_CHECK_CALL(napi_wrap(env, wrapFirst, &data, finalizeCb, nullptr, nullptr));
+        ASSERT_CHECK_CALL(napi_type_tag_object(env, wrapFirst, &typeTag));
+        // the first tag stays
+        ASSERT_CHECK_CALL(napi_type_tag_object(env, wrapFirst, &otherTag));
+
+        for (napi_value object : { tagFirst, wrapFirst }) {
+            ASSERT_CHECK_CALL(napi_check_object_type_tag(env, object, &typeTag, &tagged));
+            ASSERT_TRUE(tagged);
+            ASSERT_CHECK_CALL(napi_check_object_type_tag(env, object, &otherTag, &tagged));
+            ASSERT_FALSE(tagged);
+            ASSERT_CHECK_CALL(napi_unwrap_with_type_tag(env, object, &typeTag, &result));
+            ASSERT_EQ(result, &data);
+            ASSERT_EQ(napi_unwrap_with_type_tag(env, object, &otherTag, &result), napi_invalid_arg);
+            ASSERT_EQ(result, nullptr);
+            ASSERT_CHECK_CALL(napi_remove_wrap(env, object, &result));
+            ASSERT_CHECK_CALL(napi_check_object_type_tag(env, object, &typeTag, &tagged));
+            ASSERT_TRUE(tagged);
+        }
+        napi_value untagged = nullptr;
+        ASSERT_CHECK_CALL(napi_create_object(env, &untagged));
+        ASSERT_CHECK_CALL(napi_wrap(env, untagged, &data, finalizeCb, nullptr, nullptr));
+        ASSERT_EQ(napi_unwrap_with_type_tag(env, untagged, &typeTag, &result), napi_invalid_arg);
+    }
+
+    // an in place tag is a copy, the caller's tag may change afterwards
+    ASSERT_CHECK_CALL(napi_set_direct_wrap_enabled(env, true));
+    napi_value object = nullptr;
+    ASSERT_CHECK_CALL(napi_create_object(env, &object));
+    ASSERT_CHECK_CALL(napi_type_tag_object(env, object, &typeTag));
+    typeTag.upper++;
+    ASSERT_CHECK_CALL(napi_check_object_type_tag(env, object, &otherTag, &tagged));
+    ASSERT_FALSE(tagged);
+    typeTag.upper--;
+    ASSERT_CHECK_CALL(napi_check_object_type_tag(env, object, &typeTag, &tagged));
+    ASSERT_TRUE(tagged);
+    ASSERT_CHECK_CALL(napi_set_direct_wrap_enabled(env, false));
+}
+
+/**
+ * @tc.name: ExternalMemoryTest001
+ * @tc.desc: Test external memory reported from other threads is batched and flushed on the js thread.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiBasicTest, ExternalMemoryTest001, testing::ext::TestSize.Level1)
+{
+    static constexpr size_t threadCount = 4;
+    static constexpr size_t reportCount = 1000;
+    static constexpr int64_t reportSize = 1024;
+    UVLoopRunner runner(engine_);
+    napi_env env = reinterpret_cast<napi_env>(engine_);
+    NativeExternalMemoryAccumulator& externalMemory = engine_->GetExternalMemory();
+    ASSERT_EQ(napi_set_external_memory_flush_threshold(env, 0), napi_invalid_arg);
+
+    // no report crosses the threshold, they all stay pending
+    ASSERT_CHECK_CALL(napi_set_external_memory_flush_threshold(env, INT64_MAX));
+    int64_t total = 0;
+    ASSERT_CHECK_CALL(napi_adjust_external_memory(env, 0, &total));
+    int64_t pending = externalMemory.GetPending();
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < threadCount; ++i) {
+        threads.emplace_back([env]() {
+            for (size_t j = 0; j < reportCount; ++j) {
+                napi_report_external_memory(env, reportSize);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    int64_t reported = static_cast<int64_t>(threadCount * reportCount) * reportSize;
+    int64_t adjusted = 0;
+    ASSERT_CHECK_CALL(napi_adjust_external_memory(env, 0, &adjusted));
+    ASSERT_EQ(adjusted, total + reported);
+    ASSERT_EQ(externalMemory.GetPending(), pending + reported);
+
+    // a threshold below the pending change flushes it right away
+    ASSERT_CHECK_CALL(napi_set_external_memory_flush_threshold(env, reportSize));
+    ASSERT_EQ(externalMemory.GetPending(), 0);
+    ASSERT_EQ(externalMemory.GetTotal(), total + reported);
+
+    // crossing the threshold on another thread posts the flush to the js thread
+    engine_->GetAsyncCompletionChannel()->Hold();
+    std::thread reporter([env]() {
+        napi_report_external_memory(env, -reportSize * 2);
+    });
+    reporter.join();
+    for (size_t retry = 0; retry < 100 && externalMemory.GetPending() != 0; ++retry) {
+        runner.Run(UV_RUN_NOWAIT);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    engine_->GetAsyncCompletionChannel()->Unhold();
+    ASSERT_EQ(externalMemory.GetPending(), 0);
+    ASSERT_EQ(externalMemory.GetTotal(), total + reported - reportSize * 2);
+
+    ASSERT_CHECK_CALL(napi_adjust_external_memory(env, reportSize * 2 - reported, &adjusted));
+    ASSERT_EQ(adjusted, total);
+    ASSERT_CHECK_CALL(napi_set_external_memory_flush_threshold(env,
+        NativeExternalMemoryAccumulator::DEFAULT_FLUSH_THRESHOLD));
+}
+
+/**
+ * @tc.name: PropertyKeyCacheTest001
+ * @tc.desc: Test named property names are interned and keys made by napi_create_property_key access the same property.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiBasicTest, PropertyKeyCacheTest001, testing::ext::TestSize.Level1)
+{
+    napi_env env = reinterpret_cast<napi_env>(engine_);
+    static const char* name = "propertyKeyCacheTestField";
+    napi_value object = nullptr;
+    napi_value value = nullptr;
+    napi_value result = nullptr;
+    int32_t number = 0;
+    bool hasProperty = false;
+    ASSERT_CHECK_CALL(napi_create_object(env, &object));
+    ASSERT_CHECK_CALL(napi_create_int32(env, 1, &value));
+
+    // the key is interned whatever the implicit names of earlier cases, named calls with its name then hit
+    napi_property_key_cache_stats before;
+    ASSERT_CHECK_CALL(napi_get_property_key_cache_stats(env, &before));
+    napi_property_key key = nullptr;
+    napi_property_key sameKey = nullptr;
+    ASSERT_CHECK_CALL(napi_create_property_key(env, name, NAPI_AUTO_LENGTH, &key));
+    ASSERT_CHECK_CALL(napi_create_property_key(env, name, strlen(name), &sameKey));
+    ASSERT_EQ(key, sameKey);
+    ASSERT_CHECK_CALL(napi_set_named_property(env, object, name, value));
+    ASSERT_CHECK_CALL(napi_get_named_property(env, object, name, &result));
+    ASSERT_CHECK_CALL(napi_has_named_property(env, object, name, &hasProperty));
+    ASSERT_TRUE(hasProperty);
+    ASSERT_CHECK_CALL(napi_get_value_int32(env, result, &number));
+    ASSERT_EQ(number, 1);
+    napi_property_key_cache_stats after;
+    ASSERT_CHECK_CALL(napi_get_property_key_cache_stats(env, &after));
+    ASSERT_EQ(after.hits, before.hits + 3);
+    ASSERT_EQ(after.misses, before.misses);
+    ASSERT_EQ(after.keys, before.keys + 1);
+
+    ASSERT_CHECK_CALL(napi_get_property_by_key(env, object, key, &result));
+    ASSERT_CHECK_CALL(napi_get_value_int32(env, result, &number));
+    ASSERT_EQ(number, 1);
+    ASSERT_CHECK_CALL(napi_create_int32(env, 2, &value));
+    ASSERT_CHECK_CALL(napi_set_property_by_key(env, object, key, value));
+    ASSERT_CHECK_CALL(napi_get_named_property(env, object, name, &result));
+    ASSERT_CHECK_CALL(napi_get_value_int32(env, result, &number));
+    ASSERT_EQ(number, 2);
+
+    // length limits the name
+    napi_property_key prefixKey = nullptr;
+    ASSERT_CHECK_CALL(napi_create_property_key(env, name, strlen("property"), &prefixKey));
+    ASSERT_NE(prefixKey, key);
+    ASSERT_CHECK_CALL(napi_has_property_by_key(env, object, prefixKey, &hasProperty));
+    ASSERT_FALSE(hasProperty);
+    ASSERT_CHECK_CALL(napi_set_property_by_key(env, object, prefixKey, value));
+    ASSERT_CHECK_CALL(napi_has_named_property(env, object, "property", &hasProperty));
+    ASSERT_TRUE(hasProperty);
+
+    // names longer than the cache takes still work and are not interned
+    std::string longName(ArkPropertyKeyCache::MAX_IMPLICIT_KEY_LENGTH + 1, 'k');
+    ASSERT_CHECK_CALL(napi_get_property_key_cache_stats(env, &before));
+    ASSERT_CHECK_CALL(napi_set_named_property(env, object, longName.c_str(), value));
+    ASSERT_CHECK_CALL(napi_has_named_property(env, object, longName.c_str(), &hasProperty));
+    ASSERT_TRUE(hasProperty);
+    ASSERT_CHECK_CALL(napi_get_property_key_cache_stats(env, &after));
+    ASSERT_EQ(after.keys, before.keys);
+    ASSERT_EQ(after.misses, before.misses + 2);
+
+    // past the limit the least recently used names make room, the keys made by napi_create_property_key stay
+    static constexpr size_t implicitCount = ArkPropertyKeyCache::MAX_IMPLICIT_KEYS * 2;
+    for (size_t i = 0; i < implicitCount; ++i) {
+        std::string implicitName = "propertyKeyCacheTestImplicit" + std::to_string(i);
+        ASSERT_CHECK_CALL(napi_set_named_property(env, object, implicitName.c_str(), value));
+    }
+    ASSERT_CHECK_CALL(napi_get_property_key_cache_stats(env, &before));
+    std::string recentName = "propertyKeyCacheTestImplicit" + std::to_string(implicitCount - 1);
+    ASSERT_CHECK_CALL(napi_has_named_property(env, object, recentName.c_str(), &hasProperty));
+    ASSERT_TRUE(hasProperty);
+    ASSERT_CHECK_CALL(napi_has_named_property(env, object, "propertyKeyCacheTestImplicit0", &hasProperty));
+    ASSERT_TRUE(hasProperty);
+    ASSERT_CHECK_CALL(napi_get_property_key_cache_stats(env, &after));
+    ASSERT_EQ(after.hits, before.hits + 1);
+    ASSERT_EQ(after.misses, before.misses + 1);
+    ASSERT_EQ(after.keys, before.keys);
+    ASSERT_CHECK_CALL(napi_get_property_by_key(env, object, key, &result));
+    ASSERT_CHECK_CALL(napi_get_value_int32(env, result, &number));
+    ASSERT_EQ(number, 2);
+
+    ASSERT_EQ(napi_get_property_by_key(env, object, nullptr, &result), napi_invalid_arg);
+}
+
+/**
+ * @tc.name: PropertyKeyCacheTest002
+ * @tc.desc: Test a key made by napi_create_property_key is rejected on an env other than the one which created it.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiBasicTest, PropertyKeyCacheTest002, testing::ext::TestSize.Level1)
+{
+    napi_env env = reinterpret_cast<napi_env>(engine_);
+    napi_env contextEnv = nullptr;
+    ASSERT_CHECK_CALL(napi_create_ark_context(env, &contextEnv));
+    napi_property_key contextKey = nullptr;
+    ASSERT_CHECK_CALL(napi_create_property_key(contextEnv, "propertyKeyCacheTestContext", NAPI_AUTO_LENGTH,
+        &contextKey));
+    napi_property_key key = nullptr;
+    ASSERT_CHECK_CALL(napi_create_property_key(env, "propertyKeyCacheTestContext", NAPI_AUTO_LENGTH, &key));
+    ASSERT_NE(key, contextKey);
+
+    napi_value object = nullptr;
+    napi_value value = nullptr;
+    napi_value result = nullptr;
+    bool hasProperty = false;
+    ASSERT_CHECK_CALL(napi_create_object(env, &object));
+    ASSERT_CHECK_CALL(napi_create_int32(env, 1, &value));
+    ASSERT_EQ(napi_set_property_by_key(env, object, contextKey, value), napi_invalid_arg);
+    ASSERT_EQ(napi_has_property_by_key(env, object, contextKey, &hasProperty), napi_invalid_arg);
+    ASSERT_EQ(napi_get_property_by_key(env, object, contextKey, &result), napi_invalid_arg);
+    ASSERT_CHECK_CALL(napi_has_property_by_key(env, object, key, &hasProperty));
+    ASSERT_FALSE(hasProperty);
+
+    ASSERT_CHECK_CALL(napi_destroy_ark_context(contextEnv));
+}
+
+/**
+ * @tc.name: BatchWrapTest001
+ * @tc.desc: Test objects of a JS array and a C array are wrapped and unwrapped in one call each.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiBasicTest, BatchWrapTest001, testing::ext::TestSize.Level1)
+{
+    static constexpr size_t objectCount = 100;
+    UVLoopRunner runner(engine_);
+    napi_env env = reinterpret_cast<napi_env>(engine_);
+    auto finalizeCb = [](napi_env, void* data, void*) {
+        (*reinterpret_cast<size_t*>(data))++;
+    };
+    size_t finalized = 0;
+    std::vector<void*> natives(objectCount, &finalized);
+    std::vector<void*> results(objectCount, nullptr);
+    napi_reference_slab_stats before;
+    ASSERT_CHECK_CALL(napi_get_reference_slab_stats(env, &before));
+    {
+        panda::LocalScope scope(engine_->GetEcmaVm());
+        napi_value array = nullptr;
+        ASSERT_CHECK_CALL(napi_create_array(env, &array));
+        std::vector<napi_value> objects(objectCount);
+        for (size_t i = 0; i < objectCount; ++i) {
+            ASSERT_CHECK_CALL(napi_create_object(env, &objects[i]));
+            ASSERT_CHECK_CALL(napi_set_element(env, array, i, objects[i]));
+        }
+        ASSERT_CHECK_CALL(napi_wrap_batch(env, array, nullptr, objectCount, natives.data(), finalizeCb, nullptr, 0,
+                                          nullptr));
+        napi_reference_slab_stats stats;
+        ASSERT_CHECK_CALL(napi_get_reference_slab_stats(env, &stats));
+        EXPECT_EQ(stats.allocations, before.allocations + objectCount);
+        ASSERT_CHECK_CALL(napi_unwrap_batch(env, nullptr, objects.data(), objectCount, results.data()));
+        for (size_t i = 0; i < objectCount; ++i) {
+            ASSERT_EQ(results[i], &finalized);
+        }
+
+        napi_value number = nullptr;
+        ASSERT_CHECK_CALL(napi_create_int32(env, 1, &number));
+        ASSERT_CHECK_CALL(napi_set_element(env, array, objectCount, number));
+        ASSERT_EQ(napi_unwrap_batch(env, array, nullptr, objectCount + 1, results.data()), napi_object_expected);
+        ASSERT_EQ(napi_unwrap_batch(env, array, nullptr, objectCount + 2, results.data()), napi_invalid_arg);
+        ASSERT_EQ(napi_unwrap_batch(env, array, objects.data(), objectCount, results.data()), napi_invalid_arg);
+        ASSERT_EQ(napi_wrap_batch(env, number, nullptr, 1, natives.data(), finalizeCb, nullptr, 0, nullptr),
+                  napi_array_expected);
+    }
+    panda::JSNApi::TriggerGC(engine_->GetEcmaVm(), panda::ecmascript::GCReason::OTHER,
+                             panda::JSNApi::TRIGGER_GC_TYPE::FULL_GC);
+    runner.Run();
+    EXPECT_EQ(finalized, objectCount);
+}
+
+/**
+ * @tc.name: ReferenceGroupTest001
+ * @tc.desc: Test references and reference group members are resolved in one call and collected weak ones reported.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiBasicTest, ReferenceGroupTest001, testing::ext::TestSize.Level1)
+{
+    static constexpr size_t objectCount = 10;
+    napi_env env = reinterpret_cast<napi_env>(engine_);
+    napi_reference_group group = nullptr;
+    ASSERT_CHECK_CALL(napi_create_reference_group(env, &group));
+    napi_ref strongRef = nullptr;
+    napi_ref weakRef = nullptr;
+    {
+        panda::LocalScope scope(engine_->GetEcmaVm());
+        std::vector<napi_value> objects(objectCount);
+        for (size_t i = 0; i < objectCount; ++i) {
+            ASSERT_CHECK_CALL(napi_create_object(env, &objects[i]));
+            // the first member is strong, the others weak
+            ASSERT_CHECK_CALL(napi_reference_group_add(env, group, objects[i], i == 0 ? 1 : 0));
+        }
+        ASSERT_CHECK_CALL(napi_create_reference(env, objects[0], 1, &strongRef));
+        ASSERT_CHECK_CALL(napi_create_reference(env, objects[1], 0, &weakRef));
+
+        size_t count = 0;
+        ASSERT_CHECK_CALL(napi_reference_group_get_values(env, group, nullptr, 0, &count));
+        ASSERT_EQ(count, objectCount);
+        std::vector<napi_value> values(objectCount);
+        ASSERT_CHECK_CALL(napi_reference_group_get_values(env, group, values.data(), objectCount, &count));
+        for (size_t i = 0; i < objectCount; ++i) {
+            bool equal = false;
+            ASSERT_CHECK_CALL(napi_strict_equals(env, values[i], objects[i], &equal));
+            ASSERT_TRUE(equal);
+        }
+        ASSERT_CHECK_CALL(napi_reference_group_remove(env, group, objects[objectCount - 1]));
+        ASSERT_EQ(napi_reference_group_remove(env, group, objects[objectCount - 1]), napi_invalid_arg);
+        ASSERT_CHECK_CALL(napi_reference_group_get_values(env, group, nullptr, 0, &count));
+        ASSERT_EQ(count, objectCount - 1);
+    }
+    panda::JSNApi::TriggerGC(engine_->GetEcmaVm(), panda::ecmascript::GCReason::OTHER,
+                             panda::JSNApi::TRIGGER_GC_TYPE::FULL_GC);
+    {
+        panda::LocalScope scope(engine_->GetEcmaVm());
+        napi_ref refs[] = { strongRef, weakRef };
+        napi_value values[2] = { nullptr, nullptr };
+        size_t deadCount = 0;
+        ASSERT_CHECK_CALL(napi_get_reference_values(env, refs, 2, values, &deadCount));
+        EXPECT_NE(values[0], nullptr);
+        EXPECT_EQ(values[1], nullptr);
+        EXPECT_EQ(deadCount, 1);
+
+        // only the strong member is left
+        size_t count = 0;
+        napi_value member = nullptr;
+        ASSERT_CHECK_CALL(napi_reference_group_get_values(env, group, &member, 1, &count));
+        ASSERT_EQ(count, 1);
+        bool equal = false;
+        ASSERT_CHECK_CALL(napi_strict_equals(env, member, values[0], &equal));
+        ASSERT_TRUE(equal);
+        ASSERT_EQ(napi_reference_group_get_values(env, group, nullptr, 1, &count), napi_invalid_arg);
+    }
+    ASSERT_CHECK_CALL(napi_delete_reference(env, strongRef));
+    ASSERT_CHECK_CALL(napi_delete_reference(env, weakRef));
+    ASSERT_CHECK_CALL(napi_delete_reference_group(env, group));
+}
+
 void TestQueueAsyncWorkWithQueue(NativeEngine* engine, napi_qos_t qos)
 {
     UVLoopRunner runner(engine);
@@ -15,6 +15,7 @@
 
 #include <ctime>
 #include <sys/time.h>
+#include <vector>
 
 #include "gtest/gtest.h"
 #include "napi/native_api.h"
@@ -639,3 +640,141 @@ HWTEST_F(ArkNapiPerfomanceTest, SetNameProperty, testing::ext::TestSize.Level0)
     gettimeofday(&g_endTime, nullptr);
     TEST_TIME(napi_set_named_property);
 }
+
+static void WrapUnwrapObjects(NativeEngine* engine, bool directWrap)
+{
+    napi_env env = (napi_env)engine;
+    napi_set_direct_wrap_enabled(env, directWrap);
+    panda::LocalScope scope(engine->GetEcmaVm());
+    static int data = 0;
+    napi_value objects[NUM_COUNT] = { nullptr };
+    for (int i = 0; i < NUM_COUNT; i++) {
+        napi_create_object(env, &objects[i]);
+    }
+    size_t heapBefore = engine->GetHeapObjectSize();
+
+    gettimeofday(&g_beginTime, nullptr);
+    for (int i = 0; i < NUM_COUNT; i++) {
+        napi_wrap(env, objects[i], &data, [](napi_env, void*, void*) {}, nullptr, nullptr);
+    }
+    gettimeofday(&g_endTime, nullptr);
+    TEST_TIME(napi_wrap);
+    size_t heapAfter = engine->GetHeapObjectSize();
+    GTEST_LOG_(INFO) << "direct wrap = " << directWrap << " heap bytes per wrap = " <<
+        (heapAfter > heapBefore ? (heapAfter - heapBefore) / NUM_COUNT : 0);
+
+    void* result = nullptr;
+    gettimeofday(&g_beginTime, nullptr);
+    for (int i = 0; i < NUM_COUNT; i++) {
+        napi_unwrap(env, objects[i], &result);
+    }
+    gettimeofday(&g_endTime, nullptr);
+    TEST_TIME(napi_unwrap);
+    napi_set_direct_wrap_enabled(env, false);
+}
+
+HWTEST_F(ArkNapiPerfomanceTest, WrapUnwrap, testing::ext::TestSize.Level0)
+{
+    WrapUnwrapObjects(nativeEngine_, false);
+}
+
+HWTEST_F(ArkNapiPerfomanceTest, DirectWrapUnwrap, testing::ext::TestSize.Level0)
+{
+    WrapUnwrapObjects(nativeEngine_, true);
+}
+
+HWTEST_F(ArkNapiPerfomanceTest, WrapUnwrapBatch, testing::ext::TestSize.Level0)
+{
+    napi_env env = (napi_env)nativeEngine_;
+    panda::LocalScope scope(nativeEngine_->GetEcmaVm());
+    static int data = 0;
+    std::vector<napi_value> objects(NUM_COUNT);
+    std::vector<void*> natives(NUM_COUNT, &data);
+    for (int i = 0; i < NUM_COUNT; i++) {
+        napi_create_object(env, &objects[i]);
+    }
+
+    gettimeofday(&g_beginTime, nullptr);
+    napi_wrap_batch(env, nullptr, objects.data(), NUM_COUNT, natives.data(), [](napi_env, void*, void*) {}, nullptr,
+                    0, nullptr);
+    gettimeofday(&g_endTime, nullptr);
+    TEST_TIME(napi_wrap_batch);
+
+    gettimeofday(&g_beginTime, nullptr);
+    napi_unwrap_batch(env, nullptr, objects.data(), NUM_COUNT, natives.data());
+    gettimeofday(&g_endTime, nullptr);
+    TEST_TIME(napi_unwrap_batch);
+}
+
+static void TypeTagUnwrapObjects(NativeEngine* engine, bool directWrap)
+{
+    napi_env env = (napi_env)engine;
+    napi_set_direct_wrap_enabled(env, directWrap);
+    panda::LocalScope scope(engine->GetEcmaVm());
+    static int data = 0;
+    static const napi_type_tag typeTag = { 0x1234, 0x5678 };
+    napi_value objects[NUM_COUNT] = { nullptr };
+    for (int i = 0; i < NUM_COUNT; i++) {
+        napi_create_object(env, &objects[i]);
+        napi_type_tag_object(env, objects[i], &typeTag);
+        napi_wrap(env, objects[i], &data, [](napi_env, void*, void*) {}, nullptr, nullptr);
+    }
+
+    bool tagged = false;
+    void* result = nullptr;
+    gettimeofday(&g_beginTime, nullptr);
+    for (int i = 0; i < NUM_COUNT; i++) {
+        napi_check_object_type_tag(env, objects[i], &typeTag, &tagged);
+        napi_unwrap(env, objects[i], &result);
+    }
+    gettimeofday(&g_endTime, nullptr);
+    GTEST_LOG_(INFO) << "direct wrap = " << directWrap;
+    TEST_TIME(napi_check_object_type_tag + napi_unwrap);
+
+    gettimeofday(&g_beginTime, nullptr);
+    for (int i = 0; i < NUM_COUNT; i++) {
+        napi_unwrap_with_type_tag(env, objects[i], &typeTag, &result);
+    }
+    gettimeofday(&g_endTime, nullptr);
+    TEST_TIME(napi_unwrap_with_type_tag);
+    napi_set_direct_wrap_enabled(env, false);
+}
+
+HWTEST_F(ArkNapiPerfomanceTest, TypeTagUnwrap, testing::ext::TestSize.Level0)
+{
+    TypeTagUnwrapObjects(nativeEngine_, false);
+}
+
+HWTEST_F(ArkNapiPerfomanceTest, DirectTypeTagUnwrap, testing::ext::TestSize.Level0)
+{
+    TypeTagUnwrapObjects(nativeEngine_, true);
+}
+
+HWTEST_F(ArkNapiPerfomanceTest, NamedPropertyByKey, testing::ext::TestSize.Level0)
+{
+    napi_env env = (napi_env)nativeEngine_;
+    panda::LocalScope scope(nativeEngine_->GetEcmaVm());
+    static const char* name = "perfTestField";
+    napi_value object = nullptr;
+    napi_value value = nullptr;
+    napi_value result = nullptr;
+    napi_create_object(env, &object);
+    napi_create_int32(env, 1, &value);
+    napi_set_named_property(env, object, name, value);
+    napi_property_key key = nullptr;
+    napi_create_property_key(env, name, NAPI_AUTO_LENGTH, &key);
+
+    gettimeofday(&g_beginTime, nullptr);
+    for (int i = 0; i < NUM_COUNT; i++) {
+        napi_get_named_property(env, object, name, &result);
+    }
+    gettimeofday(&g_endTime, nullptr);
+    TEST_TIME(napi_get_named_property);
+
+    gettimeofday(&g_beginTime, nullptr);
+    for (int i = 0; i < NUM_COUNT; i++) {
+        napi_get_property_by_key(env, object, key, &result);
+    }
+    gettimeofday(&g_endTime, nullptr);
+    TEST_TIME(napi_get_property_by_key);
+}
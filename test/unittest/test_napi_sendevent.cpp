@@ -14,11 +14,18 @@
  */
 
 #include "test.h"
+
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <vector>
+
 #include "js_native_api_types.h"
 #include "js_native_api.h"
 #include "napi/native_api.h"
 #include "napi/native_node_api.h"
 #include "native_engine.h"
+#include "native_event_index.h"
 
 static char g_defaultName[] = "defaultName";
 static char g_defaultData[] = "testData";
@@ -27,6 +34,17 @@ static void Task(void* data)
 {
 }
 
+static constexpr size_t CANCEL_BENCH_EVENT_COUNT = 100000;
+static constexpr size_t CANCEL_BENCH_CANCEL_COUNT = CANCEL_BENCH_EVENT_COUNT / 2;
+static constexpr uint32_t CANCEL_BENCH_SEED = 20260417;
+static constexpr int32_t CANCEL_BENCH_MAX_LOOP_ROUNDS = 100;
+static constexpr uint64_t INDEX_TEST_KEY_COUNT = 100;
+
+static void CountTask(void* data)
+{
+    (*reinterpret_cast<size_t*>(data))++;
+}
+
 class NapiSendEventTest : public NativeEngineTest {
 public:
     static void SetUpTestSuite() {}
@@ -399,4 +417,76 @@ HWTEST_F(NapiSendEventTest, CancelEvent003, testing::ext::TestSize.Level1)
     ASSERT_NE(handleId, 0);
     auto result = napi_cancel_event(env, handleId, g_defaultName);
     ASSERT_EQ(result, napi_status::napi_ok);
-}
\ No newline at end of file
+}
+
+/**
+ * @tc.name: CancelEvent004
+ * @tc.desc: Test the handleId index keeps entries reachable across tombstones and rebuilds
+ * @tc.type:FUNC
+ */
+HWTEST_F(NapiSendEventTest, CancelEvent004, testing::ext::TestSize.Level1)
+{
+    NativeEventIndex<char> index;
+    char values[INDEX_TEST_KEY_COUNT] = { 0 };
+    EXPECT_FALSE(index.Insert(NativeEventIndex<char>::EMPTY_KEY, &values[0]));
+    EXPECT_FALSE(index.Insert(NativeEventIndex<char>::TOMBSTONE_KEY, &values[0]));
+    size_t initialCapacity = index.Capacity();
+    for (uint64_t key = 1; key <= INDEX_TEST_KEY_COUNT; ++key) {
+        ASSERT_TRUE(index.Insert(key, &values[key - 1]));
+    }
+    EXPECT_GT(index.Capacity(), initialCapacity);
+    // erase every other key, the remaining ones must still be found behind the tombstones
+    for (uint64_t key = 1; key <= INDEX_TEST_KEY_COUNT; key += 2) {
+        EXPECT_EQ(index.Erase(key, &values[key]), nullptr);
+        EXPECT_EQ(index.Erase(key, &values[key - 1]), &values[key - 1]);
+        EXPECT_EQ(index.Erase(key), nullptr);
+    }
+    EXPECT_EQ(index.Size(), static_cast<size_t>(INDEX_TEST_KEY_COUNT / 2));
+    for (uint64_t key = 1; key <= INDEX_TEST_KEY_COUNT; ++key) {
+        EXPECT_EQ(index.Find(key), (key % 2 == 0) ? &values[key - 1] : nullptr);
+    }
+}
+
+/**
+ * @tc.name: CancelEvent005
+ * @tc.desc: Benchmark napi_cancel_event on the uv path with many pending events and random cancels
+ * @tc.type:FUNC
+ */
+HWTEST_F(NapiSendEventTest, CancelEvent005, testing::ext::TestSize.Level1)
+{
+    ASSERT_NE(engine_, nullptr);
+    napi_env env = reinterpret_cast<napi_env>(engine_);
+    eventHandler_ = nullptr;
+    size_t executed = 0;
+    std::vector<uint64_t> handleIds(CANCEL_BENCH_EVENT_COUNT, 0);
+    auto sendBegin = std::chrono::steady_clock::now();
+    for (auto& handleId : handleIds) {
+        ASSERT_EQ(napi_send_cancelable_event(env, CountTask, &executed, napi_eprio_high, &handleId, g_testName),
+            napi_status::napi_ok);
+    }
+    auto sendCost = std::chrono::steady_clock::now() - sendBegin;
+
+    std::mt19937 random(CANCEL_BENCH_SEED);
+    std::shuffle(handleIds.begin(), handleIds.end(), random);
+    auto cancelBegin = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < CANCEL_BENCH_CANCEL_COUNT; ++i) {
+        ASSERT_EQ(napi_cancel_event(env, handleIds[i], g_testName), napi_status::napi_ok);
+    }
+    auto cancelCost = std::chrono::steady_clock::now() - cancelBegin;
+    // a canceled event can not be canceled twice
+    EXPECT_EQ(napi_cancel_event(env, handleIds[0], g_testName), napi_status::napi_generic_failure);
+
+    auto drainBegin = std::chrono::steady_clock::now();
+    size_t expected = CANCEL_BENCH_EVENT_COUNT - CANCEL_BENCH_CANCEL_COUNT;
+    for (int32_t round = 0; round < CANCEL_BENCH_MAX_LOOP_ROUNDS && executed < expected; ++round) {
+        uv_run(engine_->GetUVLoop(), UV_RUN_NOWAIT);
+    }
+    auto drainCost = std::chrono::steady_clock::now() - drainBegin;
+    EXPECT_EQ(executed, expected);
+
+    using std::chrono::microseconds;
+    GTEST_LOG_(INFO) << "pending events: " << CANCEL_BENCH_EVENT_COUNT << ", canceled: " << CANCEL_BENCH_CANCEL_COUNT
+                     << ", send: " << std::chrono::duration_cast<microseconds>(sendCost).count() << "us"
+                     << ", cancel: " << std::chrono::duration_cast<microseconds>(cancelCost).count() << "us"
+                     << ", drain: " << std::chrono::duration_cast<microseconds>(drainCost).count() << "us";
+}
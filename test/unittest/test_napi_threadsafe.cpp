@@ -15,8 +15,12 @@
 
 #include "test.h"
 
+#include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <thread>
+#include <utility>
+#include <vector>
 #include <uv.h>
 
 #include "event_runner.h"
@@ -1723,4 +1727,546 @@ HWTEST_F(NapiThreadsafeTest, ThreadsafeTest018, testing::ext::TestSize.Level1)
     uv_register_task_to_worker(loop, HighPrioTask);
     napi_release_threadsafe_function(tsFunc, napi_tsfn_release);
     HILOG_INFO("ThreadsafeTest018 end");
-}
\ No newline at end of file
+}
+static constexpr int32_t THROUGHPUT_PRODUCER_COUNT = 8;
+static constexpr int32_t THROUGHPUT_CALLS_PER_PRODUCER = 20000;
+static constexpr size_t THROUGHPUT_MAX_QUEUE_SIZE = 64;
+
+struct ThroughputTestData {
+    std::atomic<int32_t> received { 0 };
+    std::atomic<int32_t> rejected { 0 };
+    int32_t lastSeq[THROUGHPUT_PRODUCER_COUNT] = { 0 };
+    bool orderKept = true;
+};
+
+static void ThroughputCallJs(napi_env env, napi_value jsCb, void* context, void* data)
+{
+    auto* testData = reinterpret_cast<ThroughputTestData*>(context);
+    uintptr_t value = reinterpret_cast<uintptr_t>(data);
+    int32_t producer = static_cast<int32_t>(value / (THROUGHPUT_CALLS_PER_PRODUCER + 1));
+    int32_t seq = static_cast<int32_t>(value % (THROUGHPUT_CALLS_PER_PRODUCER + 1));
+    if (env == nullptr || producer >= THROUGHPUT_PRODUCER_COUNT) {
+        return;
+    }
+    // items from the same producer must keep their order
+    if (seq <= testData->lastSeq[producer]) {
+        testData->orderKept = false;
+    }
+    testData->lastSeq[producer] = seq;
+    testData->received++;
+}
+
+static void RunMultiProducerThroughput(napi_env env, size_t maxQueueSize, napi_threadsafe_function_call_mode mode)
+{
+    UVLoopRunner runner(reinterpret_cast<NativeEngine*>(env));
+    ThroughputTestData testData;
+    napi_value resourceName = nullptr;
+    napi_create_string_latin1(env, __func__, NAPI_AUTO_LENGTH, &resourceName);
+    napi_threadsafe_function tsfn = nullptr;
+    ASSERT_EQ(napi_create_threadsafe_function(env, nullptr, nullptr, resourceName, maxQueueSize,
+        THROUGHPUT_PRODUCER_COUNT, nullptr, nullptr, &testData, ThroughputCallJs, &tsfn), napi_ok);
+
+    auto begin = std::chrono::steady_clock::now();
+    std::vector<std::thread> producers;
+    for (int32_t producer = 0; producer < THROUGHPUT_PRODUCER_COUNT; ++producer) {
+        producers.emplace_back([tsfn, producer, mode, &testData]() {
+            for (int32_t seq = 1; seq <= THROUGHPUT_CALLS_PER_PRODUCER; ++seq) {
+                uintptr_t value = static_cast<uintptr_t>(producer) * (THROUGHPUT_CALLS_PER_PRODUCER + 1) + seq;
+                napi_status status = napi_call_threadsafe_function(tsfn, reinterpret_cast<void*>(value), mode);
+                if (status == napi_queue_full) {
+                    testData.rejected++;
+                    std::this_thread::yield();
+                    --seq;
+                    continue;
+                }
+                EXPECT_EQ(status, napi_ok);
+            }
+            EXPECT_EQ(napi_release_threadsafe_function(tsfn, napi_tsfn_release), napi_ok);
+        });
+    }
+    runner.Run();
+    for (auto& producer : producers) {
+        producer.join();
+    }
+    auto cost = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - begin);
+
+    EXPECT_EQ(testData.received.load(), THROUGHPUT_PRODUCER_COUNT * THROUGHPUT_CALLS_PER_PRODUCER);
+    EXPECT_TRUE(testData.orderKept);
+    GTEST_LOG_(INFO) << "producers: " << THROUGHPUT_PRODUCER_COUNT << ", max queue size: " << maxQueueSize
+                     << ", items: " << testData.received.load() << ", queue full retries: "
+                     << testData.rejected.load() << ", cost: " << cost.count() << "us";
+}
+
+/**
+ * @tc.name: ThreadsafeMultiProducerThroughputTest001
+ * @tc.desc: Test many producers calling an unbounded threadsafe function concurrently.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiThreadsafeTest, ThreadsafeMultiProducerThroughputTest001, testing::ext::TestSize.Level1)
+{
+    RunMultiProducerThroughput(reinterpret_cast<napi_env>(engine_), 0, napi_tsfn_nonblocking);
+}
+
+/**
+ * @tc.name: ThreadsafeMultiProducerThroughputTest002
+ * @tc.desc: Test many producers blocking on a bounded threadsafe function.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiThreadsafeTest, ThreadsafeMultiProducerThroughputTest002, testing::ext::TestSize.Level1)
+{
+    RunMultiProducerThroughput(reinterpret_cast<napi_env>(engine_), THROUGHPUT_MAX_QUEUE_SIZE, napi_tsfn_blocking);
+}
+
+/**
+ * @tc.name: ThreadsafeMultiProducerThroughputTest003
+ * @tc.desc: Test many producers retrying on a full bounded threadsafe function.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiThreadsafeTest, ThreadsafeMultiProducerThroughputTest003, testing::ext::TestSize.Level1)
+{
+    RunMultiProducerThroughput(reinterpret_cast<napi_env>(engine_), THROUGHPUT_MAX_QUEUE_SIZE, napi_tsfn_nonblocking);
+}
+
+static constexpr int32_t BATCH_PRODUCER_COUNT = 4;
+static constexpr int32_t BATCH_ITEMS_PER_PRODUCER = 4096;
+static constexpr size_t BATCH_SIZE = 16;
+static constexpr size_t BATCH_MAX_QUEUE_SIZE = 64;
+
+struct BatchTestData {
+    int32_t received = 0;
+    int32_t invocations = 0;
+    int32_t finalizedItems = 0;
+    int32_t lastSeq[BATCH_PRODUCER_COUNT] = { 0 };
+    bool orderKept = true;
+};
+
+static void BatchRecordItem(BatchTestData* testData, void* data)
+{
+    uintptr_t value = reinterpret_cast<uintptr_t>(data);
+    int32_t producer = static_cast<int32_t>(value / (BATCH_ITEMS_PER_PRODUCER + 1));
+    int32_t seq = static_cast<int32_t>(value % (BATCH_ITEMS_PER_PRODUCER + 1));
+    if (producer >= BATCH_PRODUCER_COUNT) {
+        return;
+    }
+    if (seq != testData->lastSeq[producer] + 1) {
+        testData->orderKept = false;
+    }
+    testData->lastSeq[producer] = seq;
+    testData->received++;
+}
+
+static void BatchCallJs(napi_env env, napi_value jsCb, void* context, void** data, size_t count)
+{
+    auto* testData = reinterpret_cast<BatchTestData*>(context);
+    if (env == nullptr) {
+        testData->finalizedItems += static_cast<int32_t>(count);
+        return;
+    }
+    testData->invocations++;
+    for (size_t i = 0; i < count; ++i) {
+        BatchRecordItem(testData, data[i]);
+    }
+}
+
+static void BatchItemCallJs(napi_env env, napi_value jsCb, void* context, void* data)
+{
+    auto* testData = reinterpret_cast<BatchTestData*>(context);
+    if (env == nullptr) {
+        testData->finalizedItems++;
+        return;
+    }
+    testData->invocations++;
+    BatchRecordItem(testData, data);
+}
+
+static void RunBatchProducers(napi_threadsafe_function tsfn, napi_threadsafe_function_call_mode mode)
+{
+    std::vector<std::thread> producers;
+    for (int32_t producer = 0; producer < BATCH_PRODUCER_COUNT; ++producer) {
+        producers.emplace_back([tsfn, producer, mode]() {
+            void* items[BATCH_SIZE] = { nullptr };
+            for (int32_t seq = 1; seq <= BATCH_ITEMS_PER_PRODUCER; seq += BATCH_SIZE) {
+                for (size_t i = 0; i < BATCH_SIZE; ++i) {
+                    uintptr_t value = static_cast<uintptr_t>(producer) * (BATCH_ITEMS_PER_PRODUCER + 1) + seq + i;
+                    items[i] = reinterpret_cast<void*>(value);
+                }
+                napi_status status = napi_call_threadsafe_function_batch(tsfn, items, BATCH_SIZE, mode);
+                while (status == napi_queue_full) {
+                    std::this_thread::yield();
+                    status = napi_call_threadsafe_function_batch(tsfn, items, BATCH_SIZE, mode);
+                }
+                EXPECT_EQ(status, napi_ok);
+            }
+            EXPECT_EQ(napi_release_threadsafe_function(tsfn, napi_tsfn_release), napi_ok);
+        });
+    }
+    for (auto& producer : producers) {
+        producer.join();
+    }
+}
+
+/**
+ * @tc.name: ThreadsafeBatchTest001
+ * @tc.desc: Test napi_call_threadsafe_function_batch with invalid arguments.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiThreadsafeTest, ThreadsafeBatchTest001, testing::ext::TestSize.Level1)
+{
+    napi_env env = reinterpret_cast<napi_env>(engine_);
+    BatchTestData testData;
+    napi_value resourceName = nullptr;
+    napi_create_string_latin1(env, __func__, NAPI_AUTO_LENGTH, &resourceName);
+    napi_threadsafe_function tsfn = nullptr;
+    ASSERT_EQ(napi_create_threadsafe_function_with_batch_call_js(env, nullptr, nullptr, resourceName, BATCH_SIZE, 1,
+        nullptr, nullptr, &testData, nullptr, &tsfn), napi_invalid_arg);
+    ASSERT_EQ(napi_create_threadsafe_function_with_batch_call_js(env, nullptr, nullptr, resourceName, BATCH_SIZE, 1,
+        nullptr, nullptr, &testData, BatchCallJs, &tsfn), napi_ok);
+
+    void* items[BATCH_SIZE + 1] = { nullptr };
+    ASSERT_EQ(napi_call_threadsafe_function_batch(nullptr, items, 1, napi_tsfn_nonblocking), napi_invalid_arg);
+    ASSERT_EQ(napi_call_threadsafe_function_batch(tsfn, nullptr, 1, napi_tsfn_nonblocking), napi_invalid_arg);
+    ASSERT_EQ(napi_call_threadsafe_function_batch(tsfn, items, 0, napi_tsfn_nonblocking), napi_invalid_arg);
+    // a batch larger than the queue could never be admitted
+    ASSERT_EQ(napi_call_threadsafe_function_batch(tsfn, items, BATCH_SIZE + 1, napi_tsfn_blocking), napi_invalid_arg);
+    ASSERT_EQ(napi_release_threadsafe_function(tsfn, napi_tsfn_release), napi_ok);
+}
+
+/**
+ * @tc.name: ThreadsafeBatchTest002
+ * @tc.desc: Test batches from several producers are delivered in order to a batch call_js.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiThreadsafeTest, ThreadsafeBatchTest002, testing::ext::TestSize.Level1)
+{
+    napi_env env = reinterpret_cast<napi_env>(engine_);
+    UVLoopRunner runner(engine_);
+    BatchTestData testData;
+    napi_value resourceName = nullptr;
+    napi_create_string_latin1(env, __func__, NAPI_AUTO_LENGTH, &resourceName);
+    napi_threadsafe_function tsfn = nullptr;
+    ASSERT_EQ(napi_create_threadsafe_function_with_batch_call_js(env, nullptr, nullptr, resourceName,
+        BATCH_MAX_QUEUE_SIZE, BATCH_PRODUCER_COUNT, nullptr, nullptr, &testData, BatchCallJs, &tsfn), napi_ok);
+
+    std::thread producerThread(RunBatchProducers, tsfn, napi_tsfn_blocking);
+    runner.Run();
+    producerThread.join();
+
+    EXPECT_EQ(testData.received, BATCH_PRODUCER_COUNT * BATCH_ITEMS_PER_PRODUCER);
+    EXPECT_EQ(testData.finalizedItems, 0);
+    EXPECT_TRUE(testData.orderKept);
+    // every wakeup hands all drained items to js at once
+    EXPECT_LT(testData.invocations, testData.received);
+}
+
+/**
+ * @tc.name: ThreadsafeBatchTest003
+ * @tc.desc: Test batches are delivered item by item in order to a regular call_js.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiThreadsafeTest, ThreadsafeBatchTest003, testing::ext::TestSize.Level1)
+{
+    napi_env env = reinterpret_cast<napi_env>(engine_);
+    UVLoopRunner runner(engine_);
+    BatchTestData testData;
+    napi_value resourceName = nullptr;
+    napi_create_string_latin1(env, __func__, NAPI_AUTO_LENGTH, &resourceName);
+    napi_threadsafe_function tsfn = nullptr;
+    ASSERT_EQ(napi_create_threadsafe_function(env, nullptr, nullptr, resourceName, BATCH_MAX_QUEUE_SIZE,
+        BATCH_PRODUCER_COUNT, nullptr, nullptr, &testData, BatchItemCallJs, &tsfn), napi_ok);
+
+    std::thread producerThread(RunBatchProducers, tsfn, napi_tsfn_nonblocking);
+    runner.Run();
+    producerThread.join();
+
+    EXPECT_EQ(testData.received, BATCH_PRODUCER_COUNT * BATCH_ITEMS_PER_PRODUCER);
+    EXPECT_EQ(testData.invocations, testData.received);
+    EXPECT_TRUE(testData.orderKept);
+}
+
+static constexpr int32_t DRAIN_ITEM_COUNT = 64;
+static constexpr size_t DRAIN_ITEM_BUDGET = 4;
+static constexpr uint64_t DRAIN_TIME_BUDGET_US = 1;
+static constexpr int32_t DRAIN_CALL_JS_COST_US = 10;
+
+struct DrainBudgetTestData {
+    int32_t received = 0;
+    int32_t invocations = 0;
+    size_t maxItemsPerInvocation = 0;
+};
+
+static void DrainBudgetBatchCallJs(napi_env env, napi_value jsCb, void* context, void** data, size_t count)
+{
+    auto* testData = reinterpret_cast<DrainBudgetTestData*>(context);
+    if (env == nullptr) {
+        return;
+    }
+    testData->invocations++;
+    testData->received += static_cast<int32_t>(count);
+    testData->maxItemsPerInvocation = std::max(testData->maxItemsPerInvocation, count);
+}
+
+static void DrainBudgetSlowCallJs(napi_env env, napi_value jsCb, void* context, void* data)
+{
+    auto* testData = reinterpret_cast<DrainBudgetTestData*>(context);
+    if (env == nullptr) {
+        return;
+    }
+    std::this_thread::sleep_for(std::chrono::microseconds(DRAIN_CALL_JS_COST_US));
+    testData->invocations++;
+    testData->received++;
+}
+
+/**
+ * @tc.name: ThreadsafeDrainBudgetTest001
+ * @tc.desc: Test the item budget splits a burst over several wakeups.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiThreadsafeTest, ThreadsafeDrainBudgetTest001, testing::ext::TestSize.Level1)
+{
+    napi_env env = reinterpret_cast<napi_env>(engine_);
+    UVLoopRunner runner(engine_);
+    DrainBudgetTestData testData;
+    napi_value resourceName = nullptr;
+    napi_create_string_latin1(env, __func__, NAPI_AUTO_LENGTH, &resourceName);
+    napi_threadsafe_function tsfn = nullptr;
+    ASSERT_EQ(napi_create_threadsafe_function_with_batch_call_js(env, nullptr, nullptr, resourceName, 0, 1,
+        nullptr, nullptr, &testData, DrainBudgetBatchCallJs, &tsfn), napi_ok);
+    ASSERT_EQ(napi_set_threadsafe_function_drain_budget(tsfn, DRAIN_ITEM_BUDGET, 0), napi_ok);
+
+    for (int32_t i = 0; i < DRAIN_ITEM_COUNT; ++i) {
+        ASSERT_EQ(napi_call_threadsafe_function(tsfn, nullptr, napi_tsfn_nonblocking), napi_ok);
+    }
+    uint64_t deferredDrains = 0;
+    uint64_t deferredItems = 0;
+    ASSERT_EQ(napi_get_threadsafe_function_drain_stats(tsfn, &deferredDrains, nullptr), napi_invalid_arg);
+    ASSERT_EQ(napi_get_threadsafe_function_drain_stats(tsfn, &deferredDrains, &deferredItems), napi_ok);
+    ASSERT_EQ(napi_release_threadsafe_function(tsfn, napi_tsfn_release), napi_ok);
+    runner.Run();
+
+    EXPECT_EQ(testData.received, DRAIN_ITEM_COUNT);
+    EXPECT_EQ(testData.maxItemsPerInvocation, DRAIN_ITEM_BUDGET);
+    EXPECT_EQ(testData.invocations, DRAIN_ITEM_COUNT / static_cast<int32_t>(DRAIN_ITEM_BUDGET));
+}
+
+/**
+ * @tc.name: ThreadsafeDrainBudgetTest002
+ * @tc.desc: Test the engine default time budget yields to the loop after each slow call_js.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiThreadsafeTest, ThreadsafeDrainBudgetTest002, testing::ext::TestSize.Level1)
+{
+    napi_env env = reinterpret_cast<napi_env>(engine_);
+    UVLoopRunner runner(engine_);
+    DrainBudgetTestData testData;
+    napi_value resourceName = nullptr;
+    napi_create_string_latin1(env, __func__, NAPI_AUTO_LENGTH, &resourceName);
+    ASSERT_EQ(napi_set_default_threadsafe_function_drain_budget(env, 0, DRAIN_TIME_BUDGET_US), napi_ok);
+    napi_threadsafe_function tsfn = nullptr;
+    napi_status status = napi_create_threadsafe_function(env, nullptr, nullptr, resourceName, 0, 1,
+        nullptr, nullptr, &testData, DrainBudgetSlowCallJs, &tsfn);
+    ASSERT_EQ(napi_set_default_threadsafe_function_drain_budget(env, 0, 0), napi_ok);
+    ASSERT_EQ(status, napi_ok);
+
+    for (int32_t i = 0; i < DRAIN_ITEM_COUNT; ++i) {
+        ASSERT_EQ(napi_call_threadsafe_function(tsfn, nullptr, napi_tsfn_nonblocking), napi_ok);
+    }
+    // the function stays alive until released, so the counters can be read once the burst is drained
+    while (testData.received < DRAIN_ITEM_COUNT) {
+        uv_run(engine_->GetUVLoop(), UV_RUN_ONCE);
+    }
+    uint64_t deferredDrains = 0;
+    uint64_t deferredItems = 0;
+    ASSERT_EQ(napi_get_threadsafe_function_drain_stats(tsfn, &deferredDrains, &deferredItems), napi_ok);
+    EXPECT_EQ(deferredDrains, static_cast<uint64_t>(DRAIN_ITEM_COUNT - 1));
+    // every deferral leaves the rest of the burst behind
+    EXPECT_EQ(deferredItems, static_cast<uint64_t>(DRAIN_ITEM_COUNT * (DRAIN_ITEM_COUNT - 1) / 2));
+
+    ASSERT_EQ(napi_release_threadsafe_function(tsfn, napi_tsfn_release), napi_ok);
+    runner.Run();
+    EXPECT_EQ(testData.invocations, DRAIN_ITEM_COUNT);
+}
+
+static constexpr size_t LANE_TEST_ITEM_COUNT = 200;
+
+static void* LaneItem(uintptr_t value)
+{
+    return reinterpret_cast<void*>(value);
+}
+
+/**
+ * @tc.name: ThreadsafeLaneQueueTest001
+ * @tc.desc: Test lanes are served by priority and head inserted items go first within a lane.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiThreadsafeTest, ThreadsafeLaneQueueTest001, testing::ext::TestSize.Level1)
+{
+    NativeSafeAsyncLaneQueue queue(0);
+    ASSERT_TRUE(queue.TryPush(LaneItem(1), 0));
+    queue.Push(LaneItem(2), SafeAsyncLane::IDLE, true);
+    queue.Push(LaneItem(3), SafeAsyncLane::LOW, true);
+    queue.Push(LaneItem(4), SafeAsyncLane::HIGH, true);
+    queue.Push(LaneItem(5), SafeAsyncLane::LOW, false);
+    queue.Push(LaneItem(6), SafeAsyncLane::IMMEDIATE, true);
+    queue.Push(LaneItem(7), SafeAsyncLane::HIGH, false);
+    ASSERT_EQ(queue.Size(), 7U);
+
+    const uintptr_t expected[] = { 6, 7, 4, 5, 1, 3, 2 };
+    for (uintptr_t value : expected) {
+        void* data = nullptr;
+        ASSERT_TRUE(queue.TryPop(data));
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(data), value);
+    }
+    void* data = nullptr;
+    EXPECT_FALSE(queue.TryPop(data));
+    EXPECT_TRUE(queue.Empty());
+}
+
+/**
+ * @tc.name: ThreadsafeLaneQueueTest002
+ * @tc.desc: Test low and idle lanes still make progress under a stream of immediate items.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiThreadsafeTest, ThreadsafeLaneQueueTest002, testing::ext::TestSize.Level1)
+{
+    NativeSafeAsyncLaneQueue queue(0);
+    for (size_t i = 0; i < LANE_TEST_ITEM_COUNT; ++i) {
+        queue.Push(LaneItem(static_cast<uintptr_t>(SafeAsyncLane::IMMEDIATE)), SafeAsyncLane::IMMEDIATE, true);
+    }
+    queue.Push(LaneItem(static_cast<uintptr_t>(SafeAsyncLane::LOW)), SafeAsyncLane::LOW, true);
+    queue.Push(LaneItem(static_cast<uintptr_t>(SafeAsyncLane::IDLE)), SafeAsyncLane::IDLE, true);
+
+    size_t lowPosition = 0;
+    size_t idlePosition = 0;
+    for (size_t position = 1; position <= LANE_TEST_ITEM_COUNT + 2; ++position) {
+        void* data = nullptr;
+        ASSERT_TRUE(queue.TryPop(data));
+        auto lane = static_cast<SafeAsyncLane>(reinterpret_cast<uintptr_t>(data));
+        if (lane == SafeAsyncLane::LOW) {
+            lowPosition = position;
+        } else if (lane == SafeAsyncLane::IDLE) {
+            idlePosition = position;
+        }
+    }
+    EXPECT_GT(lowPosition, 0U);
+    EXPECT_GT(idlePosition, lowPosition);
+    EXPECT_LE(idlePosition, 2 * (NativeSafeAsyncLaneQueue::STARVATION_LIMIT + 1));
+}
+
+
+static constexpr size_t FLOW_CONTROL_MAX_QUEUE_SIZE = 1;
+static constexpr uint64_t FLOW_CONTROL_TIMEOUT_MS = 10;
+static constexpr size_t FLOW_CONTROL_HIGH_WATERMARK = 8;
+static constexpr size_t FLOW_CONTROL_LOW_WATERMARK = 2;
+static constexpr size_t FLOW_CONTROL_ITEM_COUNT = 10;
+
+struct FlowControlTestData {
+    std::vector<std::pair<size_t, bool>> watermarks;
+    size_t received = 0;
+};
+
+static void FlowControlCallJs(napi_env env, napi_value jsCb, void* context, void* data)
+{
+    if (env != nullptr) {
+        reinterpret_cast<FlowControlTestData*>(context)->received++;
+    }
+}
+
+static void FlowControlWatermark(napi_threadsafe_function func, void* context, size_t depth, bool isHigh)
+{
+    reinterpret_cast<FlowControlTestData*>(context)->watermarks.emplace_back(depth, isHigh);
+}
+
+/**
+ * @tc.name: ThreadsafeFlowControlTest001
+ * @tc.desc: Test napi_create_threadsafe_function_with_flow_control with invalid arguments.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiThreadsafeTest, ThreadsafeFlowControlTest001, testing::ext::TestSize.Level1)
+{
+    napi_env env = reinterpret_cast<napi_env>(engine_);
+    FlowControlTestData testData;
+    napi_value resourceName = nullptr;
+    napi_create_string_latin1(env, __func__, NAPI_AUTO_LENGTH, &resourceName);
+    napi_threadsafe_function tsfn = nullptr;
+    napi_threadsafe_function_flow_control flowControl = { FLOW_CONTROL_LOW_WATERMARK, FLOW_CONTROL_HIGH_WATERMARK,
+        FlowControlWatermark, 0 };
+    ASSERT_EQ(napi_create_threadsafe_function_with_flow_control(env, nullptr, nullptr, resourceName, 0, 1,
+        nullptr, nullptr, &testData, FlowControlCallJs, nullptr, &tsfn), napi_invalid_arg);
+    // the low watermark must be below the high one
+    ASSERT_EQ(napi_create_threadsafe_function_with_flow_control(env, nullptr, nullptr, resourceName, 0, 1,
+        nullptr, nullptr, &testData, FlowControlCallJs, &flowControl, &tsfn), napi_invalid_arg);
+    ASSERT_EQ(napi_get_threadsafe_function_queue_stats(nullptr, nullptr), napi_invalid_arg);
+}
+
+/**
+ * @tc.name: ThreadsafeFlowControlTest002
+ * @tc.desc: Test a blocking call on a full queue gives up after the blocking timeout.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiThreadsafeTest, ThreadsafeFlowControlTest002, testing::ext::TestSize.Level1)
+{
+    napi_env env = reinterpret_cast<napi_env>(engine_);
+    UVLoopRunner runner(engine_);
+    FlowControlTestData testData;
+    napi_value resourceName = nullptr;
+    napi_create_string_latin1(env, __func__, NAPI_AUTO_LENGTH, &resourceName);
+    napi_threadsafe_function tsfn = nullptr;
+    napi_threadsafe_function_flow_control flowControl = { 0, 0, nullptr, FLOW_CONTROL_TIMEOUT_MS };
+    ASSERT_EQ(napi_create_threadsafe_function_with_flow_control(env, nullptr, nullptr, resourceName,
+        FLOW_CONTROL_MAX_QUEUE_SIZE, 1, nullptr, nullptr, &testData, FlowControlCallJs, &flowControl, &tsfn),
+        napi_ok);
+
+    size_t queued = 0;
+    while (napi_call_threadsafe_function(tsfn, nullptr, napi_tsfn_nonblocking) == napi_ok) {
+        queued++;
+    }
+    // the loop is not running, so nobody drains the queue while this call waits
+    ASSERT_EQ(napi_call_threadsafe_function(tsfn, nullptr, napi_tsfn_blocking), napi_queue_full);
+
+    napi_threadsafe_function_queue_stats stats;
+    ASSERT_EQ(napi_get_threadsafe_function_queue_stats(tsfn, &stats), napi_ok);
+    EXPECT_EQ(stats.depth, queued);
+    EXPECT_EQ(stats.peak_depth, queued);
+    EXPECT_EQ(stats.blocked_calls, 1U);
+    EXPECT_EQ(stats.timeouts, 1U);
+    EXPECT_GE(stats.blocked_time_us, FLOW_CONTROL_TIMEOUT_MS * 1000);
+
+    ASSERT_EQ(napi_release_threadsafe_function(tsfn, napi_tsfn_release), napi_ok);
+    runner.Run();
+    EXPECT_EQ(testData.received, queued);
+}
+
+/**
+ * @tc.name: ThreadsafeFlowControlTest003
+ * @tc.desc: Test the high and low watermark notifications fire once per crossing.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiThreadsafeTest, ThreadsafeFlowControlTest003, testing::ext::TestSize.Level1)
+{
+    napi_env env = reinterpret_cast<napi_env>(engine_);
+    UVLoopRunner runner(engine_);
+    FlowControlTestData testData;
+    napi_value resourceName = nullptr;
+    napi_create_string_latin1(env, __func__, NAPI_AUTO_LENGTH, &resourceName);
+    napi_threadsafe_function tsfn = nullptr;
+    napi_threadsafe_function_flow_control flowControl = { FLOW_CONTROL_HIGH_WATERMARK, FLOW_CONTROL_LOW_WATERMARK,
+        FlowControlWatermark, 0 };
+    ASSERT_EQ(napi_create_threadsafe_function_with_flow_control(env, nullptr, nullptr, resourceName, 0, 1,
+        nullptr, nullptr, &testData, FlowControlCallJs, &flowControl, &tsfn), napi_ok);
+
+    for (size_t i = 0; i < FLOW_CONTROL_ITEM_COUNT; ++i) {
+        ASSERT_EQ(napi_call_threadsafe_function(tsfn, nullptr, napi_tsfn_nonblocking), napi_ok);
+    }
+    ASSERT_EQ(testData.watermarks.size(), 1U);
+    EXPECT_EQ(testData.watermarks[0], std::make_pair(FLOW_CONTROL_HIGH_WATERMARK, true));
+    napi_threadsafe_function_queue_stats stats;
+    ASSERT_EQ(napi_get_threadsafe_function_queue_stats(tsfn, &stats), napi_ok);
+    EXPECT_EQ(stats.peak_depth, FLOW_CONTROL_ITEM_COUNT);
+    EXPECT_EQ(stats.blocked_calls, 0U);
+
+    ASSERT_EQ(napi_release_threadsafe_function(tsfn, napi_tsfn_release), napi_ok);
+    runner.Run();
+    EXPECT_EQ(testData.received, FLOW_CONTROL_ITEM_COUNT);
+    ASSERT_EQ(testData.watermarks.size(), 2U);
+    EXPECT_EQ(testData.watermarks[1], std::make_pair(static_cast<size_t>(0), false));
+}